@@ -0,0 +1,29 @@
+// Benchmark driver: times the core stages of libDDG and the application on
+// synthetic meshes (see Benchmark.h for options).  Build with "make bench".
+
+#include <iostream>
+using namespace std;
+
+#include "CommandLine.h"
+#include "Benchmark.h"
+#include "Mesh.h"
+#include "Telemetry.h"
+#include "Application.h"
+using namespace DDG;
+
+int main( int argc, char** argv )
+{
+   CommandLine args( argc, argv );
+   Benchmark bench( args );
+
+   for( int i = 0; i < bench.nCases(); i++ )
+   {
+      Mesh mesh;
+      if( bench.load( i, mesh )) return 1;
+      bench.runCore( i, mesh );
+
+      // TODO: time Application here!
+   }
+
+   return bench.finish();
+}
@@ -383,6 +383,8 @@ namespace DDG
    
    void Viewer :: drawPolygons( void )
    {
+      const MeshGeometry& geometry( mesh.geometry() );
+
       for( FaceCIter f  = mesh.faces.begin();
           f != mesh.faces.end();
           f ++ )
@@ -392,7 +394,7 @@ namespace DDG
          glBegin( GL_POLYGON );
          if( renderWireframe )
          {
-            Vector N = f->normal();
+            Vector N = geometry.normal( f );
             glNormal3dv( &N[0] );
          }
          
@@ -401,7 +403,7 @@ namespace DDG
          {
             if( not renderWireframe )
             {
-               Vector N = he->vertex->normal();
+               Vector N = geometry.normal( he->vertex );
                glNormal3dv( &N[0] );
             }
             
@@ -0,0 +1,47 @@
+// Benchmark driver: times the core stages of libDDG and the direction field
+// computation on synthetic meshes (see Benchmark.h for options).  Build with
+// "make bench".
+
+#include <iostream>
+using namespace std;
+
+#include "CommandLine.h"
+#include "Benchmark.h"
+#include "Mesh.h"
+#include "Telemetry.h"
+#include "Application.h"
+#include "Direction.h"
+using namespace DDG;
+
+int main( int argc, char** argv )
+{
+   CommandLine args( argc, argv );
+   Benchmark bench( args );
+
+   for( int i = 0; i < bench.nCases(); i++ )
+   {
+      Mesh mesh;
+      if( bench.load( i, mesh )) return 1;
+      bench.runCore( i, mesh );
+
+      // singularities are only balanced against the Euler characteristic
+      // of closed surfaces
+      if( bench.hasBoundary( i )) continue;
+
+      for( int r = 0; r < bench.repeat(); r++ )
+      {
+         if( mesh.reload() ) return 1;
+
+         Timer timer;
+         mesh.init();
+         mesh.vertices[0].singularity = mesh.getEulerCharacteristicNumber() - mesh.firstGeneratorIndex;
+         Application app;
+         if( !app.solveForConneciton( mesh )) return 1;
+         DirectionField field;
+         field.generate( mesh, 0. );
+         bench.record( i, "app", timer.elapsed() );
+      }
+   }
+
+   return bench.finish();
+}
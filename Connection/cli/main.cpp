@@ -0,0 +1,87 @@
+// Headless driver: computes a smooth direction field with the prescribed
+// singularities and writes the per-face directions without opening a window
+// (nothing here depends on OpenGL).  Build with "make cli".
+
+#include <iostream>
+#include <vector>
+using namespace std;
+
+#include "CommandLine.h"
+#include "Mesh.h"
+#include "Telemetry.h"
+#include "Application.h"
+#include "Direction.h"
+using namespace DDG;
+
+namespace DDG
+{
+   extern Telemetry telemetry;
+}
+
+int main( int argc, char** argv )
+{
+   CommandLine args( argc, argv );
+   if( args.nPositional() != 1 )
+   {
+      cerr << "usage: " << args.program() << " in.obj"
+           << " [--vertices=i,j,...] [--indices=k,l,...] [--angle=0]"
+           << " [--shortest] [--field=field.txt] [--out=out.obj]"
+           << " [--quiet] [--telemetry=stats.json]" << endl;
+      return 1;
+   }
+   telemetry.setQuiet( args.has( "quiet" ));
+
+   Mesh mesh;
+   Timer timer;
+   if( mesh.read( args.positional( 0 ))) return 1;
+   mesh.shortestGenerators = args.has( "shortest" );
+   mesh.init();
+   telemetry.record( "cli.load", timer.elapsed() );
+   telemetry.print( "cli", "load", timer.elapsed(), "s" );
+
+   // singularity k_i at vertex i
+   vector<int> vertices = args.indices( "vertices" );
+   vector<int> indices  = args.indices( "indices" );
+   if( vertices.size() != indices.size() )
+   {
+      cerr << "Error: --vertices and --indices must have the same length" << endl;
+      return 1;
+   }
+   for( size_t i = 0; i < vertices.size(); i++ )
+   {
+      if( vertices[i] < 0 || vertices[i] >= (int) mesh.vertices.size() )
+      {
+         cerr << "Error: vertex " << vertices[i] << " does not exist" << endl;
+         return 1;
+      }
+      mesh.vertices[ vertices[i] ].singularity = indices[i];
+   }
+
+   timer.start();
+   Application app;
+   if( !app.solveForConneciton( mesh ))
+   {
+      cerr << "Error: singularities do not satisfy Gauss-Bonnet" << endl;
+      return 1;
+   }
+   DirectionField field;
+   field.generate( mesh, args.value( "angle", 0. ));
+   telemetry.record( "cli.run", timer.elapsed() );
+   telemetry.print( "cli", "run", timer.elapsed(), "s" );
+
+   timer.start();
+   vector<double> directions;
+   directions.reserve( 3*mesh.faces.size() );
+   for( FaceCIter f = mesh.faces.begin(); f != mesh.faces.end(); f++ )
+   {
+      directions.push_back( f->vector.x );
+      directions.push_back( f->vector.y );
+      directions.push_back( f->vector.z );
+   }
+   if( CommandLine::writeValues( args.value( "field", "field.txt" ), directions, 3 )) return 1;
+   if( mesh.write( args.value( "out", "out.obj" ))) return 1;
+   telemetry.record( "cli.write", timer.elapsed() );
+   telemetry.print( "cli", "write", timer.elapsed(), "s" );
+
+   return args.writeTelemetry();
+}
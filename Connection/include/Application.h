@@ -19,9 +19,12 @@
 #include "SparseMatrix.h"
 #include "DiscreteExteriorCalculus.h"
 #include "Utility.h"
+#include "Telemetry.h"
 
 namespace DDG
 {
+   extern Telemetry telemetry;
+
    class Application
    {
    public:
@@ -34,15 +37,15 @@ namespace DDG
             return false;
          }
          
-         int t0 = clock();
+         Timer timer;
          solveForTrivialHolonomy(mesh);
-         int t1 = clock();
-         cout << "[trivial] time: " << seconds( t0, t1 ) << "s" << "\n";
+         telemetry.record( "trivial.time", timer.elapsed() );
+         telemetry.print( "trivial", "time", timer.elapsed(), "s" );
 
-         t0 = clock();
+         timer.start();
          solveForNonTrivialHolonomy(mesh);
-         t1 = clock();
-         cout << "[nontrivial] time: " << seconds( t0, t1 ) << "s" << "\n";
+         telemetry.record( "nontrivial.time", timer.elapsed() );
+         telemetry.print( "nontrivial", "time", timer.elapsed(), "s" );
          
          return true;
       }
@@ -78,7 +81,7 @@ namespace DDG
             double value = 0.0;
             if( not v->onBoundary() )
             {
-               value -= ( 2. * M_PI - v->theta() );
+               value -= mesh.angleDefects[ v->index ];
                value += 2. * M_PI * v->singularity;
             }
             b( v->index ) = value;
@@ -101,8 +104,9 @@ namespace DDG
          if( nb == 0 ) return;
          mesh.harmonicCoefs = std::vector<double>(nb, 0.0);
 
-         DenseMatrix<Real>  b(nb);
-         SparseMatrix<Real> H(nb,nb);
+         // only the right-hand side depends on the singularities; the
+         // period matrix was inverted by Mesh::init()
+         DenseMatrix<Real> b(nb);
          
          int row = 0;
          bool skipBoundaryLoop = true;
@@ -114,15 +118,6 @@ namespace DDG
                skipBoundaryLoop = false;
                continue;
             }
-            
-            for(unsigned j = 0; j < cycle.size(); ++j)
-            {
-               HalfEdgeIter he = cycle[j];
-               for(unsigned col = 0; col < nb; ++col)
-               {
-                  H(row,col) += he->harmonicBases[col];
-               }
-            }
 
             double value = - mesh.generatorHolonomy( cycle );
             if( row == 0 )
@@ -134,7 +129,7 @@ namespace DDG
          }
          
          DenseMatrix<Real> x(nb);
-         if( b.norm() > 1.0e-8 ) solve(H, x, b);
+         if( b.norm() > 1.0e-8 ) x = mesh.inversePeriods * b;
 
          for(unsigned i = 0; i < nb; ++i)
             mesh.harmonicCoefs[i] = x(i);
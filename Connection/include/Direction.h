@@ -1,7 +1,10 @@
 #ifndef DDG_DIRECTION_H
 #define DDG_DIRECTION_H
 
+#include <vector>
 #include "Mesh.h"
+#include "Holonomy.h"
+#include "Parallel.h"
 #include "Quaternion.h"
 
 namespace DDG
@@ -10,19 +13,66 @@ namespace DDG
    {
    public:
       void generate(Mesh& mesh, double angle, bool debugMode = false)
+      // breadth-first sweep over the dual graph; each face receives the
+      // vector of the face it was reached from, transported across the
+      // shared edge (faces not reachable from the first face start over
+      // with a vector at the prescribed angle)
       {
+         int nF = mesh.faces.size();
+         HalfEdgeIter none = mesh.halfedges.end();
+         std::vector<int> order;
+         std::vector<HalfEdgeIter> parent( nF, none );
+         // faces in the order they are reached, and the halfedge of each
+         // face across which it was reached (none for the first face of
+         // each connected component)
+
          setFaceTag(mesh, false);
-         
-         FaceIter f = mesh.faces.begin();
-         init(f, angle);
+         order.reserve( nF );
+         for( FaceIter root = mesh.faces.begin(); root != mesh.faces.end(); root++ )
+         {
+            if( root->tag ) continue;
+            root->tag = true;
+
+            size_t begin = order.size();
+            order.push_back( root->index );
+            for( size_t k = begin; k < order.size(); k++ )
+            {
+               FaceIter f = mesh.faces.begin() + order[k];
+               HalfEdgeIter he = f->he;
+               do
+               {
+                  HalfEdgeIter h = he->flip;
+                  if( !h->onBoundary && !h->face->tag )
+                  {
+                     h->face->tag = true;
+                     parent[ h->face->index ] = h;
+                     order.push_back( h->face->index );
+                  }
+                  he = he->next;
+               }
+               while( he != f->he );
+            }
+         }
 
-         HalfEdgeIter he = f->he;
-         do
+         // transport across each tree edge (independent of the vectors)
+         std::vector<Quaternion> rotation( nF );
+         mesh.geometry();
+         parallelFor( 0, nF, [&]( int begin, int end )
          {
-            propagate( mesh, he->flip, f->vector );
-            he = he->next;
+            for( int i = begin; i < end; i++ )
+            {
+               if( parent[i] != none ) rotation[i] = transportRotation( mesh, parent[i] );
+            }
+         });
+
+         // linear sweep: parents come before their children
+         for( size_t k = 0; k < order.size(); k++ )
+         {
+            FaceIter f = mesh.faces.begin() + order[k];
+            HalfEdgeIter h = parent[ order[k] ];
+            if( h == none ) init(f, angle);
+            else f->vector = rotate( h->flip->face->vector, rotation[ order[k] ] );
          }
-         while( he != f->he );
 
          if( debugMode ) debug(mesh);
       }
@@ -48,54 +98,56 @@ namespace DDG
          f->tag = true;         
       }
       
-      void propagate(const Mesh& mesh, HalfEdgeIter h, const Vector& v)
+      Vector transport(const Mesh& mesh, const Vector& v, HalfEdgeIter h) const
       {
-         if( h->onBoundary ) return;
-         if( h->face->tag ) return;
-         
-         FaceIter f = h->face;
-         f->vector = transport(mesh, v, h);
-         f->tag = true;
-         
-         HalfEdgeIter he = f->he;
-         do
-         {
-            propagate( mesh, he->flip, f->vector );
-            he = he->next;
-         }
-         while( he != f->he );
+         return rotate( v, transportRotation( mesh, h ));
       }
 
-      Vector transport(const Mesh& mesh, const Vector& v, HalfEdgeIter h) const
+      Quaternion transportRotation(const Mesh& mesh, HalfEdgeIter h) const
+      // rotation that carries vectors from h->flip->face to h->face: first
+      // by the connection angle around the normal of h->flip->face, then
+      // by the dihedral angle around the shared edge
       {
-         if( h->onBoundary or h->flip->onBoundary ) return v;
+         if( h->onBoundary or h->flip->onBoundary ) return Quaternion( 1. );
          
          Vector p1 = h->flip->vertex->position;
          Vector p0 = h->vertex->position;
          Vector e = (p1 - p0).unit();
 
-         Vector nR = h->flip->face->normal();
-         Vector nL = h->face->normal();
+         const MeshGeometry& geometry( mesh.geometry() );
+         Vector nR = geometry.normal( h->flip->face );
+         Vector nL = geometry.normal( h->face );
          Vector nLxnR = cross( nL, nR );
          double dihedral = atan2( nLxnR.norm(), dot( nL, nR ) );
          if( dot( e, nLxnR ) < 0.0 ) dihedral = -dihedral;
                   
-         Vector u = rotate( v, nR, -mesh.connectionOneForm(h) );
-         return rotate( u, e, dihedral );
+         return rotation( nR, -mesh.connectionOneForm(h) ) * rotation( e, dihedral );
       }
 
-      Vector rotate(const Vector& v, const Vector& axis, double angle) const
+      Quaternion rotation(const Vector& axis, double angle) const
       {
          angle *= 0.5;
-         Quaternion q( std::cos(angle), std::sin(angle) * axis );
+         return Quaternion( std::cos(angle), std::sin(angle) * axis );
+      }
+
+      Vector rotate(const Vector& v, const Quaternion& q) const
+      {
          return ( q.conj() * Quaternion(v) * q ).im();
       }
+
+      Vector rotate(const Vector& v, const Vector& axis, double angle) const
+      {
+         return rotate( v, rotation( axis, angle ));
+      }
       
       // debug //
       
       void debug(Mesh& mesh) const
       {
          std::cout << "DEBUG-BEGIN" << std::endl;
+
+         Holonomy holonomy;
+         holonomy.compute(mesh);
          
          for( VertexIter v = mesh.vertices.begin();
              v != mesh.vertices.end();
@@ -122,7 +174,7 @@ namespace DDG
             while( offset >= 2.0*M_PI ) offset -= 2.*M_PI;
             if( std::abs(offset-2.0*M_PI) < 1.0e-6 ) offset = 0.0;
             
-            double sing = mesh.vertexHolonomy(v);
+            double sing = holonomy.vertex[ v->index ];
             
             while( sing < 0.0       ) sing += 2.*M_PI;
             while( sing >= 2.0*M_PI ) sing -= 2.*M_PI;
@@ -143,13 +195,14 @@ namespace DDG
             const Mesh::Generator& cycle = mesh.generators[i];
             if( cycle.empty() ) continue;
             
-            Vector n = cycle[0]->face->normal();
-            Vector u0 = cycle[0]->face->vector;
+            HalfEdgeIter h0 = mesh.halfedges.begin() + cycle[0];
+            Vector n = h0->face->normal();
+            Vector u0 = h0->face->vector;
             
             Vector u = u0;
             for( int k = cycle.size()-1; k >= 0; k-- )
             {
-               u = transport(mesh, u, cycle[k]);
+               u = transport(mesh, u, mesh.halfedges.begin() + cycle[k]);
             }
 
             double offset = atan2( cross(u,u0).norm(), dot(u,u0) );
@@ -159,7 +212,7 @@ namespace DDG
             while( offset >= 2.0*M_PI ) offset -= 2.*M_PI;
             if( std::abs(offset-2.0*M_PI) < 1.0e-6 ) offset = 0.0;
 
-            double sing = mesh.generatorHolonomy(cycle);
+            double sing = holonomy.generator[i];
             
             while( sing < 0.0       ) sing += 2.*M_PI;
             while( sing >= 2.0*M_PI ) sing -= 2.*M_PI;
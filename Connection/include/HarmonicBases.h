@@ -1,6 +1,7 @@
 #ifndef DDG_HARMONIC_BASES_H
 #define DDG_HARMONIC_BASES_H
 
+#include <vector>
 #include "Mesh.h"
 #include "Real.h"
 #include "DenseMatrix.h"
@@ -13,76 +14,89 @@ namespace DDG
    {
    public:
       void compute(Mesh& mesh)
+      // computes one harmonic one-form per generator (except the first
+      // boundary loop) and stores them as the columns of mesh.harmonicBases;
+      // all generators are handled at once by a single multi-RHS solve.
+      // Also inverts the period matrix into mesh.inversePeriods, so that
+      // solving for new singularities takes a matrix-vector product only
       {
-         cleanHalfEdges( mesh );
-         if( mesh.generators.empty() ) return;
-
-         SparseMatrix<Real> star1, d0, div;
-         HodgeStar1Form<Real>::build( mesh, star1 );
-         ExteriorDerivative0Form<Real>::build( mesh, d0 );
-         div = d0.transpose() * star1;
-         
+         std::vector<unsigned> cycles;
          bool skipBoundaryLoop = true;
          for(unsigned i = 0; i < mesh.generators.size(); ++i)
          {
-            const Mesh::Generator& cycle = mesh.generators[i];
-            if( skipBoundaryLoop and mesh.isBoundaryGenerator(cycle) )
+            if( skipBoundaryLoop and mesh.isBoundaryGenerator(mesh.generators[i]) )
             {
                skipBoundaryLoop = false;
                continue;
             }
-            
-            DenseMatrix<Real> w;
-            buildClosedPrimalOneForm(mesh, cycle, w);
-                        
-            DenseMatrix<Real> u;
-            DenseMatrix<Real> divw = div * w;
-            backsolvePositiveDefinite( mesh.L, u, divw );
-            
-            DenseMatrix<Real> h = star1*( w - (d0*u) );
-            storeHarmonicForm(h, mesh);
-          }
+            cycles.push_back(i);
+         }
+
+         if( cycles.empty() )
+         {
+            mesh.harmonicBases = DenseMatrix<Real>();
+            mesh.inversePeriods = DenseMatrix<Real>();
+            return;
+         }
+
+         SparseMatrix<Real> star1, d0, div;
+         HodgeStar1Form<Real>::build( mesh, star1 );
+         ExteriorDerivative0Form<Real>::build( mesh, d0 );
+         div = d0.transpose() * star1;
+         
+         DenseMatrix<Real> w( mesh.edges.size(), cycles.size() );
+         for(unsigned k = 0; k < cycles.size(); ++k)
+         {
+            buildClosedPrimalOneForm(mesh, mesh.generators[ cycles[k] ], k, w);
+         }
+
+         DenseMatrix<Real> u;
+         DenseMatrix<Real> divw = div * w;
+         backsolvePositiveDefinite( mesh.L, u, divw );
+
+         mesh.harmonicBases = star1*( w - (d0*u) );
+
+         invertPeriods(mesh, cycles);
       }
       
    protected:
+      void invertPeriods(Mesh& mesh, const std::vector<unsigned>& cycles) const
+      {
+         int nb = cycles.size();
+         SparseMatrix<Real> H(nb,nb);
+         for(int row = 0; row < nb; ++row)
+         {
+            const Mesh::Generator& cycle = mesh.generators[ cycles[row] ];
+            for(unsigned j = 0; j < cycle.size(); ++j)
+            {
+               HalfEdgeCIter he = mesh.halfedges.begin() + cycle[j];
+               for(int col = 0; col < nb; ++col)
+               {
+                  H(row,col) += mesh.harmonicBasis(he, col);
+               }
+            }
+         }
+
+         // one QR factorization, applied to all columns of the identity
+         DenseMatrix<Real> I(nb,nb);
+         for(int i = 0; i < nb; ++i) I(i,i) = 1.0;
+         solve(H, mesh.inversePeriods, I);
+      }
+
       void buildClosedPrimalOneForm(const Mesh& mesh,
                                     const Mesh::Generator& cycle,
+                                    unsigned column,
                                     DenseMatrix<Real>& oneform) const
       {
-         oneform = DenseMatrix<Real>( mesh.edges.size() );
          for(unsigned i = 0; i < cycle.size(); ++i)
          {
             double value = 1.0;
-            HalfEdgeIter he = cycle[i];
+            HalfEdgeCIter he = mesh.halfedges.begin() + cycle[i];
             if( he->edge->he != he ) value = -value;
-            oneform( he->edge->index ) = value;
-         }
-      }
-      
-      void storeHarmonicForm(const DenseMatrix<Real>& oneform,
-                             Mesh& mesh)
-      {
-         for(EdgeIter e = mesh.edges.begin();
-             e != mesh.edges.end();
-             e ++)
-         {
-            double value = oneform(e->index);
-            e->he->harmonicBases.push_back( value );
-            e->he->flip->harmonicBases.push_back( -value );
-         }
-      }
-      
-      void cleanHalfEdges(Mesh& mesh)
-      {
-         for(EdgeIter e = mesh.edges.begin();
-             e != mesh.edges.end();
-             e ++)
-         {
-            e->he->harmonicBases.clear();
-            e->he->flip->harmonicBases.clear();
+            oneform( he->edge->index, column ) = value;
          }
       }
    };
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,183 @@
+#ifndef DDG_HOLONOMY_H
+#define DDG_HOLONOMY_H
+
+#include <cmath>
+#include <vector>
+#include "Mesh.h"
+#include "MeshAdjacency.h"
+#include "Parallel.h"
+
+namespace DDG
+{
+   class Holonomy
+   // Evaluates the holonomy of the current connection around every vertex
+   // and every generator at once.  Mesh::vertexHolonomy() and
+   // Mesh::generatorHolonomy() rebuild two face frames and the connection
+   // one-form for each halfedge they cross; here the frames are built once
+   // per face, the transport angle once per halfedge and the one-form once
+   // per edge, and the sums are then read from flat arrays.  Results match
+   // the per-element functions bit for bit.
+   {
+   public:
+      void compute(const Mesh& mesh)
+      {
+         buildFrames(mesh);
+         buildTransport(mesh);
+         buildConnection(mesh);
+         sumVertices(mesh);
+         sumGenerators(mesh);
+      }
+
+      std::vector<double> transport;
+      // Mesh::parallelTransport() per position in mesh.halfedges
+
+      std::vector<double> connection;
+      // Mesh::connectionOneForm() per position in mesh.halfedges
+
+      std::vector<double> vertex;
+      // Mesh::vertexHolonomy() per vertex index
+
+      std::vector<double> generator;
+      // Mesh::generatorHolonomy() per generator
+
+   protected:
+      std::vector<Vector> frameA;
+      std::vector<Vector> frameB;
+      // Mesh::faceFrame() of f->he per face index
+
+      std::vector<double> edgeConnection;
+      // Mesh::connectionOneForm() of e->he per edge index
+
+      void buildFrames(const Mesh& mesh)
+      {
+         int nF = mesh.faces.size();
+         frameA.resize( nF );
+         frameB.resize( nF );
+         const MeshGeometry& geometry( mesh.geometry() );
+         parallelFor( 0, nF, [&]( int begin, int end )
+         {
+            for( int i = begin; i < end; i++ )
+            {
+               HalfEdgeCIter h = mesh.faces[i].he;
+               Vector a = ( h->next->vertex->position - h->vertex->position ).unit();
+               frameA[i] = a;
+               frameB[i] = cross( geometry.normal( h->face ), a );
+            }
+         });
+      }
+
+      void buildTransport(const Mesh& mesh)
+      {
+         int nH = mesh.halfedges.size();
+         transport.resize( nH );
+         parallelFor( 0, nH, [&]( int begin, int end )
+         {
+            for( int i = begin; i < end; i++ )
+            {
+               HalfEdgeCIter h = mesh.halfedges.begin() + i;
+               if( h->onBoundary or h->flip->onBoundary )
+               {
+                  transport[i] = 0.0;
+                  continue;
+               }
+
+               Vector e = h->next->vertex->position - h->vertex->position;
+               int fL = h->face->index;
+               int fR = h->flip->face->index;
+               double deltaL = atan2( dot(e,frameB[fL]), dot(e,frameA[fL]) );
+               double deltaR = atan2( dot(e,frameB[fR]), dot(e,frameA[fR]) );
+               transport[i] = deltaL - deltaR;
+            }
+         });
+      }
+
+      void buildConnection(const Mesh& mesh)
+      {
+         int nE = mesh.edges.size();
+         int nb = mesh.harmonicCoefs.size();
+         edgeConnection.resize( nE );
+         const MeshGeometry& geometry( mesh.geometry() );
+         parallelFor( 0, nE, [&]( int begin, int end )
+         {
+            // coclosed term
+            for( int i = begin; i < end; i++ )
+            {
+               HalfEdgeCIter h = mesh.edges[i].he;
+               double star1 = 0.5 * ( geometry.cotan( h ) + geometry.cotan( h->flip ) );
+               double u0 = h->flip->vertex->potential;
+               double u1 = h->vertex->potential;
+               edgeConnection[i] = star1*(u1 - u0);
+            }
+
+            // harmonic term, one column of the bases at a time
+            for( int k = 0; k < nb; k++ )
+            {
+               double c = mesh.harmonicCoefs[k];
+               for( int i = begin; i < end; i++ )
+               {
+                  edgeConnection[i] += c * mesh.harmonicBases( i, k );
+               }
+            }
+         });
+
+         int nH = mesh.halfedges.size();
+         connection.resize( nH );
+         parallelFor( 0, nH, [&]( int begin, int end )
+         {
+            for( int i = begin; i < end; i++ )
+            {
+               HalfEdgeCIter h = mesh.halfedges.begin() + i;
+               double value = edgeConnection[ h->edge->index ];
+               connection[i] = h->edge->he == h ? value : -value;
+            }
+         });
+      }
+
+      void sumVertices(const Mesh& mesh)
+      {
+         const MeshAdjacency& adjacency( mesh.adjacency() );
+         vertex.resize( mesh.vertices.size() );
+         forEachVertexOneRing( adjacency, [&]( int i, int begin, int end )
+         {
+            double sum = 2.0*M_PI;
+            for( int k = begin; k < end; k++ )
+            {
+               sum += transport[ adjacency.halfedge[k] ];
+               sum += connection[ adjacency.halfedge[k] ];
+            }
+            vertex[i] = sum;
+         });
+      }
+
+      void sumGenerators(const Mesh& mesh)
+      {
+         int nG = mesh.generators.size();
+         generator.resize( nG );
+         parallelFor( 0, nG, [&]( int begin, int end )
+         {
+            for( int i = begin; i < end; i++ )
+            {
+               const Mesh::Generator& cycle = mesh.generators[i];
+               double sum = 0.0;
+               if( cycle.empty() )
+               {
+                  generator[i] = sum;
+                  continue;
+               }
+
+               for( unsigned k = 0; k < cycle.size(); ++k )
+               {
+                  sum += transport[ cycle[k] ];
+                  sum += connection[ cycle[k] ];
+               }
+
+               while( sum <  0.0      ) sum += 2.0*M_PI;
+               while( sum >= 2.0*M_PI ) sum -= 2.0*M_PI;
+               generator[i] = sum;
+            }
+         }, 1 );
+      }
+   };
+}
+
+#endif
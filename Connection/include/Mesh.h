@@ -49,6 +49,10 @@
 #include "Vertex.h"
 #include "Edge.h"
 #include "Face.h"
+#include "MeshAdjacency.h"
+#include "MeshGeometry.h"
+#include "MeshOrdering.h"
+#include "DenseMatrix.h"
 #include "SparseMatrix.h"
 
 namespace DDG
@@ -56,7 +60,8 @@ namespace DDG
    class Mesh
    {
    public:
-      typedef std::vector<HalfEdgeIter> Generator;
+      typedef std::vector<int> Generator;
+      // dual cycle, as positions in halfedges of the halfedges it crosses
 
       Mesh( void );
       // constructs an empty mesh
@@ -86,6 +91,28 @@ namespace DDG
       
       double meanEdgeLength( void  ) const;
       // returns mean edge lenght
+
+      const MeshGeometry& geometry( void ) const;
+      // returns cached cotangents, areas, normals, etc., recomputing
+      // them first if the cache has been invalidated
+
+      void invalidateGeometry( void );
+      // marks the cached geometry as stale; must be called after
+      // changing vertex positions or connectivity
+
+      const MeshAdjacency& adjacency( void ) const;
+      // returns the one rings of all vertices in flat arrays (see
+      // MeshAdjacency.h), recollecting them first if the cache has
+      // been invalidated
+
+      void invalidateConnectivity( void );
+      // marks the cached adjacency and geometry as stale; must be
+      // called after editing connectivity
+
+      void reorder( MeshOrdering::Strategy strategy );
+      // permutes vertices, edges, faces and halfedges to improve memory
+      // locality (see MeshOrdering.h) and reassigns element indices;
+      // iterators stored in the mesh remain valid, all others do not
       
       int getEulerCharacteristicNumber( void ) const;
       // returns Euler Characteristic Number
@@ -96,13 +123,13 @@ namespace DDG
       unsigned numberHarmonicBases() const;
       // returns 2g + (m-1) where g = genus and m = number of boundary loops
       
-      double connectionOneForm(HalfEdgeIter h) const;
+      double connectionOneForm(HalfEdgeCIter h) const;
       // returns rotation angle by crossing h
       
-      double parallelTransport(HalfEdgeIter h) const;
+      double parallelTransport(HalfEdgeCIter h) const;
       // returns rotation around h->vertex
       
-      void faceFrame(HalfEdgeIter h, Vector& a, Vector& b) const;
+      void faceFrame(HalfEdgeCIter h, Vector& a, Vector& b) const;
       // returns unit edge vector parallel to h and
       // its rotation by \pi/2 around the face's normal
       
@@ -112,6 +139,9 @@ namespace DDG
       double generatorHolonomy(const Generator& cycle) const;
       // returns defect angle by rotating around cycle
       
+      double harmonicBasis(HalfEdgeCIter h, int k) const;
+      // returns the value of the k-th harmonic basis on h
+      
       void init();
       // pre-compute data
       
@@ -125,16 +155,41 @@ namespace DDG
       SparseFactor<Real> L;
       // pre-factorization of Laplacian
 
+      std::vector<double> angleDefects;
+      // 2\pi minus the angle sum per vertex index (zero on the boundary),
+      // i.e., the curvature term of the trivial-holonomy system
+
       std::vector<Generator> generators;
       // non-contractible loops
 
+      bool shortestGenerators;
+      // if true, init() extracts a greedy shortest homotopy basis
+      // instead of the breadth-first tree-cotree basis (closed meshes only)
+
+      DenseMatrix<Real> harmonicBases;
+      // harmonic one-forms, one row per edge (oriented along e->he)
+      // and one column per basis
+
       std::vector<double> harmonicCoefs;
       // coefficients for linear combination of harmonic bases
 
+      DenseMatrix<Real> inversePeriods;
+      // inverse of the period matrix, whose entry (i,k) integrates the k-th
+      // harmonic basis along the i-th generator; maps prescribed generator
+      // holonomies to harmonicCoefs
+
       double firstGeneratorIndex;
       
    protected:
       std::string inputFilename;
+
+      mutable MeshGeometry cachedGeometry;
+      mutable bool geometryIsValid;
+      // per-element quantities, computed on demand by geometry()
+
+      mutable MeshAdjacency cachedAdjacency;
+      mutable bool adjacencyIsValid;
+      // one rings, collected on demand by adjacency()
       
       void indexElements( void );
       // assigns a unique, 0-based index to each mesh element
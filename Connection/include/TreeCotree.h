@@ -1,23 +1,76 @@
 #ifndef DDG_TREE_COTREE_H
 #define DDG_TREE_COTREE_H
 
+#include <algorithm>
+#include <functional>
+#include <limits>
 #include <queue>
+#include <utility>
+#include <vector>
 #include "Mesh.h"
 
 namespace DDG
 {
    class TreeCotree
+   // Extracts a homology basis as dual cycles (see Mesh::Generator).  A
+   // primal spanning tree T and a dual spanning tree C of the edges not in T
+   // leave 2g (plus boundary) edges; each closes a cycle in C, which is
+   // found by walking both faces of the edge up to their lowest common
+   // ancestor.  With "shortest", C is a shortest-path tree of the dual graph
+   // and T a maximum spanning tree weighted by the length of the cycle each
+   // edge would close, which yields the greedy shortest homotopy basis of
+   // Erickson and Whittlesey (closed surfaces only).
    {
    public:
-      void build(Mesh& mesh)
+      void build(Mesh& mesh, bool shortest = false)
       {
          mesh.generators.clear();
-         buildPrimalSpanningTree(mesh);
-         buildDualSpanningCoTree(mesh);
+         inPrimalTree.assign( mesh.edges.size(), false );
+         inDualTree.assign( mesh.edges.size(), false );
+         if( mesh.faces.empty() ) return;
+
+         // the greedy basis is only defined for closed surfaces
+         if( shortest and mesh.boundaries.empty() )
+         {
+            buildShortestDualTree(mesh);
+            buildLongestPrimalCoTree(mesh);
+         }
+         else
+         {
+            buildPrimalSpanningTree(mesh);
+            buildDualSpanningCoTree(mesh);
+         }
          buildCycles(mesh);
       }
-      
+
    protected:
+      std::vector<bool> inPrimalTree;
+      std::vector<bool> inDualTree;
+      // per edge
+
+      std::vector<int> parentHalfEdge;
+      // per face, the halfedge of the face across which its parent in the
+      // dual tree lies, or -1 at the root
+
+      std::vector<int> depth;
+      // per face, the number of edges to the root of the dual tree
+
+      std::vector<double> distance;
+      // per face, the length of the dual path to the root ("shortest" only)
+
+      std::vector<int> path1, path2;
+      // temporaries of buildCycles()
+
+      int position(const Mesh& mesh, HalfEdgeCIter h) const
+      {
+         return &*h - &mesh.halfedges[0];
+      }
+
+      int parentFace(const Mesh& mesh, int f) const
+      {
+         return mesh.halfedges[ parentHalfEdge[f] ].flip->face->index;
+      }
+
       void buildCycles(Mesh& mesh)
       {
          for( EdgeIter e = mesh.edges.begin();
@@ -25,88 +78,88 @@ namespace DDG
               e++ )
          {
             if( e->he->onBoundary or e->he->flip->onBoundary ) continue;
-            if( inPrimalSpanningTree( e->he ) ) continue;
-            if( inDualSpanningTree( e->he ) ) continue;
+            if( inPrimalTree[ e->index ] ) continue;
+            if( inDualTree[ e->index ] ) continue;
 
-            // path to root from right face
-            Mesh::Generator c1;
-            FaceIter f = e->he->flip->face;
-            while( f != f->parent )
+            // paths from the right and left face up to their lowest
+            // common ancestor
+            int f1 = e->he->flip->face->index;
+            int f2 = e->he->face->index;
+            if( depth[f1] == -1 or depth[f2] == -1 ) continue;
+            path1.clear();
+            path2.clear();
+            while( depth[f1] > depth[f2] )
             {
-               c1.push_back( sharedHalfEdge( f, f->parent ));
-               f = f->parent;
+               path1.push_back( parentHalfEdge[f1] );
+               f1 = parentFace( mesh, f1 );
             }
-
-            // path to root from left face
-            Mesh::Generator c2;
-            f = e->he->face;
-            while( f != f->parent )
+            while( depth[f2] > depth[f1] )
+            {
+               path2.push_back( parentHalfEdge[f2] );
+               f2 = parentFace( mesh, f2 );
+            }
+            while( f1 != f2 )
             {
-               c2.push_back( sharedHalfEdge( f, f->parent ));
-               f = f->parent;
+               path1.push_back( parentHalfEdge[f1] );
+               f1 = parentFace( mesh, f1 );
+               path2.push_back( parentHalfEdge[f2] );
+               f2 = parentFace( mesh, f2 );
             }
-            
+
             // build cycle
             Mesh::Generator g;
-            g.push_back( e->he );
-            int m = c1.size()-1;
-            int n = c2.size()-1;
-            while( c1[m] == c2[n] ) { m--; n--; }
-            for( int i = 0; i <= m; i++ ) g.push_back( c1[i] );
-            for( int i = n; i >= 0; i-- ) g.push_back( c2[i]->flip );
-               
+            g.reserve( 1 + path1.size() + path2.size() );
+            g.push_back( position( mesh, e->he ));
+            for( size_t i = 0; i < path1.size(); i++ ) g.push_back( path1[i] );
+            for( size_t i = path2.size(); i > 0; i-- )
+            {
+               g.push_back( position( mesh, mesh.halfedges[ path2[i-1] ].flip ));
+            }
+
             // make sure that boundary loops wind around the boundary
             // in a consistent direction
-            if( isDualBoundaryLoop( g ))
+            if( mesh.isBoundaryGenerator( g ))
             {
-               if( g[0]->next->vertex->onBoundary() )
+               if( mesh.halfedges[ g[0] ].next->vertex->onBoundary() )
                {
                   // reverse cycle
-                  unsigned int n = g.size();
-                  for( unsigned int i = 0; i < n; i++ )
-                  {
-                     g[i] = g[i]->flip;
-                  }
-                  for( unsigned int i = 0; i < n/2; i++ )
+                  for( size_t i = 0; i < g.size(); i++ )
                   {
-                     swap( g[i], g[n-1-i] );
+                     g[i] = position( mesh, mesh.halfedges[ g[i] ].flip );
                   }
+                  std::reverse( g.begin(), g.end() );
                }
             }
-               
+
             mesh.generators.push_back(g);
          }
       }
-      
+
       void buildPrimalSpanningTree(Mesh& mesh)
       {
-         // reset parent
-         for( VertexIter v = mesh.vertices.begin();
-              v != mesh.vertices.end();
-              v++ )
-         {
-            v->parent = v;
-         }
-         
          // set root as non-boundary vertex
          VertexIter root = mesh.vertices.begin();
-         while( root->onBoundary() ) root++;
+         while( root != mesh.vertices.end() and root->onBoundary() ) root++;
+         if( root == mesh.vertices.end() ) return;
 
-         // spanning tree
+         // spanning tree (breadth-first)
+         std::vector<bool> visited( mesh.vertices.size(), false );
          std::queue<VertexIter> Q;
          Q.push( root );
+         visited[ root->index ] = true;
          while( !Q.empty() )
          {
             VertexIter v = Q.front();
             Q.pop();
-            
+
             HalfEdgeIter he = v->he;
             do
             {
                VertexIter w = he->flip->vertex;
-               if( w->parent == w and w != root and !w->onBoundary() )
+               if( !visited[ w->index ] and !w->onBoundary() )
                {
-                  w->parent = v;
+                  visited[ w->index ] = true;
+                  inPrimalTree[ he->edge->index ] = true;
                   Q.push( w );
                }
                he = he->flip->next;
@@ -114,37 +167,33 @@ namespace DDG
             while( he != v->he );
          }
       }
-      
+
       void buildDualSpanningCoTree(Mesh& mesh)
       {
-         // reset parent
-         for( FaceIter f = mesh.faces.begin();
-              f != mesh.faces.end();
-              f++ )
-         {
-            f->parent = f;
-         }
-         
-         // set root as non-boundary face
+         int nF = mesh.faces.size();
+         parentHalfEdge.assign( nF, -1 );
+         depth.assign( nF, -1 );
+
+         // spanning tree (breadth-first) avoiding the primal tree
          FaceIter root = mesh.faces.begin();
-         while( root->isBoundary() ) root++;
-         
-         // spanning tree
          std::queue<FaceIter> Q;
          Q.push( root );
+         depth[ root->index ] = 0;
          while( !Q.empty() )
          {
             FaceIter f = Q.front();
             Q.pop();
-            
+
             HalfEdgeIter he = f->he;
             do
             {
                FaceIter g = he->flip->face;
-               if( g->parent == g and g != root and !g->isBoundary() and
-                   !inPrimalSpanningTree( he ) )
+               if( !he->flip->onBoundary and depth[ g->index ] == -1 and
+                   !inPrimalTree[ he->edge->index ] )
                {
-                  g->parent = f;
+                  parentHalfEdge[ g->index ] = position( mesh, he->flip );
+                  depth[ g->index ] = depth[ f->index ] + 1;
+                  inDualTree[ he->edge->index ] = true;
                   Q.push( g );
                }
                he = he->next;
@@ -152,38 +201,101 @@ namespace DDG
             while( he != f->he );
          }
       }
-      
-      bool inPrimalSpanningTree( HalfEdgeIter he ) const
-      {
-         VertexIter v = he->vertex;
-         VertexIter w = he->flip->vertex;
-         return v->parent == w or w->parent == v;
-      }
-      
-      bool inDualSpanningTree( HalfEdgeIter he ) const
+
+      void buildShortestDualTree(Mesh& mesh)
+      // Dijkstra's algorithm on the dual graph, with dual edges as long as
+      // the distance between the barycenters of the two faces
       {
-         FaceIter f = he->face;
-         FaceIter g = he->flip->face;
-         return f->parent == g or g->parent == f;
+         int nF = mesh.faces.size();
+         parentHalfEdge.assign( nF, -1 );
+         depth.assign( nF, -1 );
+         distance.assign( nF, std::numeric_limits<double>::infinity() );
+
+         std::vector<Vector> center( nF );
+         for( FaceCIter f = mesh.faces.begin(); f != mesh.faces.end(); f++ )
+         {
+            center[ f->index ] = f->barycenter();
+         }
+
+         typedef std::pair<double,int> Entry;
+         std::priority_queue< Entry, std::vector<Entry>, std::greater<Entry> > Q;
+         int root = mesh.faces.begin()->index;
+         distance[root] = 0.;
+         Q.push( Entry( 0., root ));
+         while( !Q.empty() )
+         {
+            Entry top = Q.top();
+            Q.pop();
+            int f = top.second;
+            if( depth[f] != -1 ) continue;
+            depth[f] = parentHalfEdge[f] == -1 ? 0 : depth[ parentFace( mesh, f ) ] + 1;
+            if( parentHalfEdge[f] != -1 )
+            {
+               inDualTree[ mesh.halfedges[ parentHalfEdge[f] ].edge->index ] = true;
+            }
+
+            HalfEdgeCIter he = mesh.faces[f].he;
+            do
+            {
+               if( !he->flip->onBoundary )
+               {
+                  int g = he->flip->face->index;
+                  double d = distance[f] + ( center[g] - center[f] ).norm();
+                  if( depth[g] == -1 and d < distance[g] )
+                  {
+                     distance[g] = d;
+                     parentHalfEdge[g] = position( mesh, he->flip );
+                     Q.push( Entry( d, g ));
+                  }
+               }
+               he = he->next;
+            }
+            while( he != mesh.faces[f].he );
+         }
       }
 
-      HalfEdgeIter sharedHalfEdge( FaceIter f, FaceIter g ) const
+      void buildLongestPrimalCoTree(Mesh& mesh)
+      // Kruskal's algorithm for a maximum spanning tree of the vertices,
+      // where each edge weighs as much as the dual cycle it would close
       {
-         HalfEdgeIter he = f->he;
-         do
+         std::vector< std::pair<double,int> > candidates;
+         for( EdgeCIter e = mesh.edges.begin(); e != mesh.edges.end(); e++ )
+         {
+            HalfEdgeCIter he = e->he;
+            if( he->onBoundary or he->flip->onBoundary ) continue;
+            if( inDualTree[ e->index ] ) continue;
+
+            int f = he->face->index;
+            int g = he->flip->face->index;
+            if( depth[f] == -1 or depth[g] == -1 ) continue;
+            double length = distance[f] + distance[g] +
+                            ( he->face->barycenter() - he->flip->face->barycenter() ).norm();
+            candidates.push_back( std::make_pair( -length, e->index ));
+         }
+         std::sort( candidates.begin(), candidates.end() );
+
+         std::vector<int> component( mesh.vertices.size() );
+         for( size_t i = 0; i < component.size(); i++ ) component[i] = i;
+         for( size_t k = 0; k < candidates.size(); k++ )
          {
-            if( he->flip->face == g ) return he;
-            he = he->next;
+            HalfEdgeCIter he = mesh.edges[ candidates[k].second ].he;
+            int a = find( component, he->vertex->index );
+            int b = find( component, he->flip->vertex->index );
+            if( a == b ) continue;
+            component[a] = b;
+            inPrimalTree[ candidates[k].second ] = true;
          }
-         while( he != f->he );
-         assert( 0 );
       }
-      
-      bool isDualBoundaryLoop( const Mesh::Generator& cycle ) const
+
+      int find(std::vector<int>& component, int i) const
+      // union-find lookup with path halving
       {
-         if( cycle.size() == 0 ) return false;
-         return ( cycle[0]->vertex->onBoundary() or
-                  cycle[0]->flip->vertex->onBoundary() );
+         while( component[i] != i )
+         {
+            component[i] = component[ component[i] ];
+            i = component[i];
+         }
+         return i;
       }
    };
 }
@@ -36,9 +36,6 @@ namespace DDG
       double singularity;
       // singularity index
       
-      VertexIter parent;
-      // parent in tree-cotree decomposition
-      
       Vertex() : index(0), tag(false), potential(0.0), singularity(0.0)
       { }
       
@@ -7,17 +7,27 @@
 #include "TreeCotree.h"
 #include "HarmonicBases.h"
 #include "Utility.h"
+#include "Parallel.h"
+#include "Telemetry.h"
 
 using namespace std;
 
 namespace DDG
 {
+   extern Telemetry telemetry;
+
    Mesh :: Mesh( void )
+   : shortestGenerators( false ),
+     geometryIsValid( false ),
+     adjacencyIsValid( false )
    {
       firstGeneratorIndex = 0;
    }
    
    Mesh :: Mesh( const Mesh& mesh )
+   : shortestGenerators( false ),
+     geometryIsValid( false ),
+     adjacencyIsValid( false )
    {
       *this = mesh;
    }
@@ -71,6 +81,9 @@ namespace DDG
       for(   EdgeIter e =    edges.begin(); e !=    edges.end(); e++ ) e->he = halfedgeOldToNew[ e->he ];
       for(   FaceIter f =    faces.begin(); f !=    faces.end(); f++ ) f->he = halfedgeOldToNew[ f->he ];
       
+      shortestGenerators = mesh.shortestGenerators;
+      invalidateConnectivity();
+      
       return *this;
    }
    
@@ -85,6 +98,8 @@ namespace DDG
          return 1;
       }
       
+      invalidateGeometry();
+      
       int rval;
       if( !( rval = MeshIO::read( in, *this )))
       {
@@ -142,6 +157,8 @@ namespace DDG
       {
          v->position /= rMax;
       }
+      
+      invalidateGeometry();
    }
    
    void Mesh::indexElements( void )
@@ -166,6 +183,8 @@ namespace DDG
          f->index = nF;
          nF++;
       }
+
+      adjacencyIsValid = false;
    }
    
    double Mesh::area( void ) const
@@ -202,8 +221,9 @@ namespace DDG
    bool Mesh :: isBoundaryGenerator(const Generator& cycle) const
    {
       if( cycle.size() == 0 ) return false;
-      return ( cycle[0]->vertex->onBoundary() or
-               cycle[0]->flip->vertex->onBoundary() );
+      HalfEdgeCIter h = halfedges.begin() + cycle[0];
+      return ( h->vertex->onBoundary() or
+               h->flip->vertex->onBoundary() );
    }
 
    unsigned Mesh :: numberHarmonicBases() const
@@ -223,7 +243,7 @@ namespace DDG
       return nb;
    }
 
-   void Mesh :: faceFrame(HalfEdgeIter h, Vector& a, Vector& b) const
+   void Mesh :: faceFrame(HalfEdgeCIter h, Vector& a, Vector& b) const
    {
       if( h->onBoundary ) return;
       
@@ -231,11 +251,11 @@ namespace DDG
       VertexIter v1 = h->next->vertex;
       
       a = ( v1->position - v0->position ).unit();
-      Vector n = h->face->normal();
+      Vector n = geometry().normal( h->face );
       b = cross( n, a );
    }
    
-   double Mesh :: parallelTransport(HalfEdgeIter h) const
+   double Mesh :: parallelTransport(HalfEdgeCIter h) const
    {
       if( h->onBoundary or h->flip->onBoundary ) return 0.0;
       
@@ -254,19 +274,20 @@ namespace DDG
       return (deltaL - deltaR);
    }
    
-   double Mesh :: connectionOneForm(HalfEdgeIter h) const
+   double Mesh :: connectionOneForm(HalfEdgeCIter h) const
    {
       double angle = 0.0;
       
       // coclosed term
-      double star1 = 0.5 * ( h->cotan() + h->flip->cotan() );
+      const MeshGeometry& g( geometry() );
+      double star1 = 0.5 * ( g.cotan( h ) + g.cotan( h->flip ) );
       double u0 = h->flip->vertex->potential;
       double u1 = h->vertex->potential;
       angle += star1*(u1 - u0);
       
       // harmonic term
-      for(unsigned k = 0; k < h->harmonicBases.size(); ++k)
-         angle += this->harmonicCoefs[k] * h->harmonicBases[k];
+      for(unsigned k = 0; k < harmonicCoefs.size(); ++k)
+         angle += this->harmonicCoefs[k] * harmonicBasis(h, k);
       
       return angle;
    }
@@ -292,7 +313,7 @@ namespace DDG
       
       for(unsigned k = 0; k < cycle.size(); ++k)
       {
-         HalfEdgeIter h = cycle[k];
+         HalfEdgeCIter h = halfedges.begin() + cycle[k];
          sum += parallelTransport(h);
          sum += connectionOneForm(h);
       }
@@ -302,6 +323,12 @@ namespace DDG
       return sum;
    }
    
+   double Mesh :: harmonicBasis(HalfEdgeCIter h, int k) const
+   {
+      double value = harmonicBases( h->edge->index, k );
+      return h->edge->he == h ? value : -value;
+   }
+   
    void Mesh :: init()
    {
       // Laplacian with Neumann boundary condition
@@ -316,25 +343,86 @@ namespace DDG
       
       // pre-factorize
       this->L.build(Delta);
+
+      // curvature term, which does not depend on the singularities
+      angleDefects.resize( vertices.size() );
+      parallelFor( 0, vertices.size(), [&]( int begin, int end )
+      {
+         for( int i = begin; i < end; i++ )
+         {
+            const Vertex& v( vertices[i] );
+            angleDefects[i] = v.onBoundary() ? 0.0 : 2.*M_PI - v.theta();
+         }
+      });
       
       // generators
-      int t0 = clock();
+      Timer timer;
       TreeCotree tct;
-      tct.build( *this );
-      int t1 = clock();
-      cout << "[generators] time: " << seconds( t0, t1 ) << "s" << "\n";
+      tct.build( *this, shortestGenerators );
+      telemetry.record( "generators.time", timer.elapsed() );
+      telemetry.print( "generators", "time", timer.elapsed(), "s" );
       
       unsigned nb = this->numberHarmonicBases();
-      if( nb == 0 ) return;
+      if( nb == 0 )
+      {
+         this->harmonicCoefs.clear();
+         this->harmonicBases = DenseMatrix<Real>();
+         this->inversePeriods = DenseMatrix<Real>();
+         return;
+      }
 
       // harmonic coefs
       this->harmonicCoefs = std::vector<double>( nb, 0.0 );
       
       // harmonic bases
-      t0 = clock();
+      timer.start();
       HarmonicBases bases;
       bases.compute( *this );
-      t1 = clock();
-      cout << "[harmonic] time: " << seconds( t0, t1 ) << "s" << "\n";      
+      telemetry.record( "harmonic.time", timer.elapsed() );
+      telemetry.print( "harmonic", "time", timer.elapsed(), "s" );
+   }
+   
+   const MeshGeometry& Mesh::geometry( void ) const
+   {
+      if( !geometryIsValid )
+      {
+         cachedGeometry.build( *this );
+         geometryIsValid = true;
+      }
+      return cachedGeometry;
+   }
+   
+   void Mesh::invalidateGeometry( void )
+   {
+      geometryIsValid = false;
+   }
+
+   const MeshAdjacency& Mesh::adjacency( void ) const
+   {
+      if( !adjacencyIsValid )
+      {
+         cachedAdjacency.build( *this );
+         adjacencyIsValid = true;
+      }
+      return cachedAdjacency;
+   }
+
+   void Mesh::invalidateConnectivity( void )
+   {
+      adjacencyIsValid = false;
+      invalidateGeometry();
+   }
+
+   void Mesh::reorder( MeshOrdering::Strategy strategy )
+   {
+      MeshOrdering ordering;
+      ordering.build( *this, strategy );
+      ordering.apply( *this );
+      indexElements();
+      invalidateGeometry();
+
+      // the factorization, tree-cotree and harmonic bases refer to the old
+      // order, so recompute them if they have been computed before
+      if( L.valid() ) init();
    }
 }
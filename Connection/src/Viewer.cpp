@@ -647,6 +647,8 @@ namespace DDG
    
    void Viewer :: drawPolygons( void )
    {
+      const MeshGeometry& geometry( mesh.geometry() );
+
       glEnable(GL_COLOR_MATERIAL);
       for( FaceCIter f  = mesh.faces.begin();
           f != mesh.faces.end();
@@ -657,7 +659,7 @@ namespace DDG
          glBegin( GL_POLYGON );
          if( renderWireframe )
          {
-            Vector N = f->normal();
+            Vector N = geometry.normal( f );
             glNormal3dv( &N[0] );
          }
          
@@ -666,7 +668,7 @@ namespace DDG
          {
             if( not renderWireframe )
             {
-               Vector N = he->vertex->normal();
+               Vector N = geometry.normal( he->vertex );
                glNormal3dv( &N[0] );
             }
             
@@ -893,7 +895,7 @@ namespace DDG
          
          for(unsigned j = 0; j < mesh.generators[i].size(); ++j)
          {
-            HalfEdgeIter h = mesh.generators[i][j];
+            HalfEdgeIter h = mesh.halfedges.begin() + mesh.generators[i][j];
             if( h->onBoundary or h->flip->onBoundary ) continue;
             
             Vector p0 = h->vertex->position;
@@ -0,0 +1,63 @@
+// Benchmark driver: times the core stages of libDDG and the interpolation
+// between a disc and a swirled copy of it on synthetic meshes (see
+// Benchmark.h for options).  Build with "make bench".
+
+#include <cmath>
+#include <iostream>
+using namespace std;
+
+#include "CommandLine.h"
+#include "Benchmark.h"
+#include "Mesh.h"
+#include "Telemetry.h"
+#include "Application.h"
+using namespace DDG;
+
+void swirl( Mesh& mesh )
+// rotates each point by an angle that falls off with the distance to the
+// origin; the map preserves area and orientation
+{
+   for( VertexIter v = mesh.vertices.begin(); v != mesh.vertices.end(); v++ )
+   {
+      double x = v->position.x;
+      double y = v->position.y;
+      double theta = 1. - ( x*x + y*y );
+      v->position.x = cos(theta)*x - sin(theta)*y;
+      v->position.y = sin(theta)*x + cos(theta)*y;
+   }
+   mesh.invalidateGeometry();
+}
+
+int main( int argc, char** argv )
+{
+   CommandLine args( argc, argv );
+   Benchmark bench( args );
+
+   for( int i = 0; i < bench.nCases(); i++ )
+   {
+      Mesh mesh;
+      if( bench.load( i, mesh )) return 1;
+      bench.runCore( i, mesh );
+
+      // shapes are interpolated in the plane
+      if( bench.shape( i ) != "disc" ) continue;
+
+      Mesh source, target;
+      if( source.read( bench.meshFile() )) return 1;
+      if( target.read( bench.meshFile() )) return 1;
+      swirl( target );
+
+      for( int r = 0; r < bench.repeat(); r++ )
+      {
+         if( mesh.reload() ) return 1;
+
+         Timer timer;
+         Application app;
+         app.init( .5, source, target, mesh );
+         app.interpolate( .5, source, target, mesh );
+         bench.record( i, "app", timer.elapsed() );
+      }
+   }
+
+   return bench.finish();
+}
@@ -0,0 +1,82 @@
+// Headless driver: interpolates between two planar shapes and writes either a
+// single intermediate shape or a sequence of frames without opening a window
+// (nothing here depends on OpenGL).  Build with "make cli".
+
+#include <iostream>
+#include <string>
+using namespace std;
+
+#include "CommandLine.h"
+#include "Mesh.h"
+#include "Telemetry.h"
+#include "Application.h"
+using namespace DDG;
+
+namespace DDG
+{
+   extern Telemetry telemetry;
+}
+
+int main( int argc, char** argv )
+{
+   CommandLine args( argc, argv );
+   if( args.nPositional() != 2 )
+   {
+      cerr << "usage: " << args.program() << " src.obj tgt.obj"
+           << " [--solver=newton|lbfgs|localglobal] [--iters=20] [--tolerance=1e-8]"
+           << " [--t=0.5] [--out=out.obj] [--frames=n [--prefix=frame]]"
+           << " [--quiet] [--telemetry=stats.json]" << endl;
+      return 1;
+   }
+   telemetry.setQuiet( args.has( "quiet" ));
+
+   Application::Solver solver;
+   string name = args.value( "solver", "newton" );
+   if     ( name == "newton"      ) solver = Application::newton;
+   else if( name == "lbfgs"       ) solver = Application::lbfgs;
+   else if( name == "localglobal" ) solver = Application::localGlobal;
+   else
+   {
+      cerr << "Error: unknown solver " << name << endl;
+      return 1;
+   }
+   int maxIters = args.value( "iters", 20 );
+   double tolerance = args.value( "tolerance", 1e-8 );
+
+   Mesh source, target, mesh;
+   Timer timer;
+   if( source.read( args.positional( 0 ))) return 1;
+   if( target.read( args.positional( 1 ))) return 1;
+   if( mesh.read( args.positional( 0 ))) return 1;
+   telemetry.record( "cli.load", timer.elapsed() );
+   telemetry.print( "cli", "load", timer.elapsed(), "s" );
+
+   Application app( solver );
+
+   if( args.has( "frames" ))
+   {
+      // frames are written as they are computed
+      timer.start();
+      int nFrames = args.value( "frames", 10 );
+      string prefix = args.value( "prefix", "frame" );
+      if( app.interpolateSequence( source, target, mesh, nFrames, prefix,
+                                   maxIters, tolerance )) return 1;
+      telemetry.record( "cli.run", timer.elapsed() );
+      telemetry.print( "cli", "run", timer.elapsed(), "s" );
+      return args.writeTelemetry();
+   }
+
+   timer.start();
+   double t = args.value( "t", 0.5 );
+   app.init( t, source, target, mesh );
+   app.interpolate( t, source, target, mesh, maxIters, tolerance );
+   telemetry.record( "cli.run", timer.elapsed() );
+   telemetry.print( "cli", "run", timer.elapsed(), "s" );
+
+   timer.start();
+   if( mesh.write( args.value( "out", "out.obj" ))) return 1;
+   telemetry.record( "cli.write", timer.elapsed() );
+   telemetry.print( "cli", "write", timer.elapsed(), "s" );
+
+   return args.writeTelemetry();
+}
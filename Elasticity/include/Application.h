@@ -3,25 +3,53 @@
  * Isaac Chao, Ulrich Pinkall, Patrick Sanan, Peter Schröder
  * ACM Transactions on Graphics, 29(4), 2010, 38:1-38:6.
  *
- * TODO: implemented just a gradient descent; use full Newton's method
+ * Three solvers are provided for the interpolation energy: the original
+ * local/global iteration (linear convergence), Newton's method with a
+ * backtracking line search (quadratic convergence near the solution), and
+ * L-BFGS preconditioned by the factored rest Laplacian, whose iterations
+ * cost only a backsolve (meant for meshes too large to refactor the Hessian).
  *
  */
 
 #ifndef DDG_APPLICATION_H
 #define DDG_APPLICATION_H
 
+#include <cmath>
+#include <deque>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
 #include "Mesh.h"
 #include "Complex.h"
 #include "DenseMatrix.h"
 #include "SparseMatrix.h"
 #include "DiscreteExteriorCalculus.h"
 #include "PolarDecomposition2x2.h"
+#include "ElasticEnergy.h"
+#include "Parallel.h"
+#include "Telemetry.h"
 
 namespace DDG
 {
    class Application
    {
    public:
+      enum Solver
+      {
+         localGlobal,
+         newton,
+         lbfgs
+      };
+
+      Application(Solver solver_ = newton)
+      : solver(solver_)
+      {}
+
+      Solver solver;
+      // method used by interpolate()
+
       void interpolate(const double t,
                        const Mesh& source,
                        const Mesh& target,
@@ -29,17 +57,132 @@ namespace DDG
                        int max_iters = 20,
                        double tolerance = 1.0e-8)
       {
-         SparseMatrix<Complex> src_L;
-         computeLaplacian(source, src_L);
+         buildOperators(source, target);
+         solve(t, source, target, mesh, max_iters, tolerance);
+      }
+      
+      int interpolateSequence(const Mesh& source,
+                              const Mesh& target,
+                              Mesh& mesh,
+                              int nFrames,
+                              const std::string& prefix,
+                              int max_iters = 20,
+                              double tolerance = 1.0e-8)
+      // computes nFrames equally spaced frames from t = 0 to t = 1 and writes
+      // frame i to prefix followed by i as five digits and ".obj"; the
+      // operators are built once, all factorizations share one symbolic
+      // analysis (the sparsity pattern does not depend on t), and each frame
+      // starts from the previous solution.  Returns nonzero if a frame could
+      // not be written
+      {
+         buildOperators(source, target);
+         init(0., source, target, mesh);
          
-         SparseMatrix<Complex> tgt_L;
-         computeLaplacian(target, tgt_L);
+         for( int i = 0; i < nFrames; i++ )
+         {
+            double t = nFrames > 1 ? double(i)/double(nFrames-1) : 0.;
+            
+            Timer timer;
+            int iters = solve(t, source, target, mesh, max_iters, tolerance);
+            double seconds = timer.elapsed();
+            telemetry.record("elasticity.frame", seconds);
+            
+            std::ostringstream filename;
+            filename << prefix << std::setw(5) << std::setfill('0') << i << ".obj";
+            if( mesh.write(filename.str()) )
+            {
+               std::cerr << "Error: could not write " << filename.str() << std::endl;
+               return 1;
+            }
+            
+            if( !telemetry.quiet() )
+            {
+               std::cout << "Frame " << i << " (t = " << t << "): "
+                         << iters << " iterations, " << seconds << "s" << std::endl;
+            }
+         }
          
-         SparseMatrix<Complex> L  = Complex(1.-t)*src_L   + Complex(t)*tgt_L;
-         SparseFactor<Complex> LL;
-         LL.build( L );
+         return 0;
+      }
+      
+      void init(const double step,
+                const Mesh& source,
+                const Mesh& target,
+                Mesh& mesh)
+      {
+         VertexCIter sv = source.vertices.begin();
+         VertexCIter tv = target.vertices.begin();
+         VertexIter  v  = mesh.vertices.begin();
+         for( ; v != mesh.vertices.end(); v++, tv++, sv++)
+         {
+            v->position = (1.-step)*sv->position + step*tv->position;
+         }
+         mesh.invalidateGeometry();
+      }
+      
+   protected:
+      SparseMatrix<Complex> src_L;
+      SparseMatrix<Complex> tgt_L;
+      // rest Laplacians of source and target
+      
+      SparseMatrix<Complex> L;
+      SparseFactor<Complex> LL;
+      // interpolated Laplacian and its factor
+      
+      ElasticEnergy energy;
+      SparseFactor<Real> HH;
+      // elastic energy and the factor of its Hessian
+      
+      void buildOperators(const Mesh& source,
+                          const Mesh& target)
+      // builds everything that depends only on the rest shapes
+      {
+         computeLaplacian(source, src_L);
+         computeLaplacian(target, tgt_L);
+         energy.build(source, target);
+      }
+      
+      void factorLaplacian(const double t)
+      // factors L = (1-t) src_L + t tgt_L, reusing the previous symbolic
+      // analysis if there is one
+      {
+         L = Complex(1.-t)*src_L + Complex(t)*tgt_L;
+         LL.refactor( L );
+      }
+      
+      int solve(const double t,
+                const Mesh& source,
+                const Mesh& target,
+                Mesh& mesh,
+                int max_iters,
+                double tolerance)
+      // runs the selected solver starting from the current positions of mesh;
+      // returns the number of iterations taken
+      {
+         switch( solver )
+         {
+            case localGlobal:
+               return interpolateLocalGlobal(t, source, target, mesh, max_iters, tolerance);
+            case newton:
+               return interpolateNewton(t, source, target, mesh, max_iters, tolerance);
+            case lbfgs:
+               return interpolateLBFGS(t, source, target, mesh, max_iters, tolerance);
+         }
+         return 0;
+      }
+      
+      int interpolateLocalGlobal(const double t,
+                                 const Mesh& source,
+                                 const Mesh& target,
+                                 Mesh& mesh,
+                                 int max_iters,
+                                 double tolerance)
+      {
+         factorLaplacian(t);
 
-         for( int iter = 0; iter < max_iters; iter++ )
+         double res = 0.;
+         int iter;
+         for( iter = 0; iter < max_iters; iter++ )
          {
             // extract rotation from deformation gradient
             DenseMatrix<Complex> src_angle;
@@ -60,69 +203,281 @@ namespace DDG
             DenseMatrix<Complex> x;
             get2DPositions(mesh, x);
                         
-            double res = residual(L, x, rhs);
-            std::cout << "Iter" << iter << ": res = " << res << std::endl;
+            res = residual(L, x, rhs);
+            reportIteration(iter, res);
             if (res < tolerance) break;
             
             backsolvePositiveDefinite(LL, x, rhs);
             x.removeMean();
             assign2DPositions(x, mesh);
          }
+         recordSolve(iter, res);
+         return iter;
       }
       
-      void init(const double step,
-                const Mesh& source,
-                const Mesh& target,
-                Mesh& mesh)
+      int interpolateNewton(const double t,
+                            const Mesh& source,
+                            const Mesh& target,
+                            Mesh& mesh,
+                            int max_iters,
+                            double tolerance)
       {
-         VertexCIter sv = source.vertices.begin();
-         VertexCIter tv = target.vertices.begin();
-         VertexIter  v  = mesh.vertices.begin();
-         for( ; v != mesh.vertices.end(); v++, tv++, sv++)
+         energy.setTime(t);
+         
+         DenseMatrix<Real> x, g, dx;
+         getPositions(mesh, x);
+         bool laplacianFactored = false;
+         
+         // the Hessian has the same sparsity pattern at every iteration (and
+         // for every t), so the symbolic analysis is done only once
+         double res = 0.;
+         int iter;
+         for( iter = 0; iter < max_iters; iter++ )
          {
-            v->position = (1.-step)*sv->position + step*tv->position;
+            res = energy.gradient(x, g);
+            reportIteration(iter, res);
+            if (res < tolerance) break;
+            
+            // near a minimum the exact Hessian is positive definite and gives
+            // quadratic convergence; elsewhere fall back to the projected one
+            bool factored = refactorQuietly(energy.hessian(x, false)) ||
+                            HH.refactor(energy.hessian(x, true));
+            
+            double step = 0.;
+            if( factored )
+            {
+               DenseMatrix<Real> rhs = -g;
+               backsolvePositiveDefinite(HH, dx, rhs);
+               step = lineSearch(x, g, dx);
+            }
+            
+            // if that gives no descent, take a gradient step preconditioned
+            // by the rest Laplacian, as the local/global iteration does
+            if( step == 0. )
+            {
+               if( !laplacianFactored )
+               {
+                  factorLaplacian(t);
+                  laplacianFactored = true;
+               }
+               preconditionGradient(g, dx);
+               dx = -dx;
+               step = lineSearch(x, g, dx);
+            }
+            
+            if( step == 0. )
+            {
+               reportStall("Newton", iter, res);
+               break;
+            }
          }
+         
+         assignPositions(x, mesh);
+         recordSolve(iter, res);
+         return iter;
       }
       
-   protected:
-      void computeRotation(const Mesh& meshA,
-                           const Mesh& meshB,
-                           DenseMatrix<Complex>& angle) const
+      int interpolateLBFGS(const double t,
+                           const Mesh& source,
+                           const Mesh& target,
+                           Mesh& mesh,
+                           int max_iters,
+                           double tolerance,
+                           int history = 8)
       {
-         angle = DenseMatrix<Complex>(meshA.faces.size(),1);
-         FaceCIter fA = meshA.faces.begin();
-         FaceCIter fB = meshB.faces.begin();
-         for( ; fA != meshA.faces.end(); fA++, fB++)
+         energy.setTime(t);
+         
+         // the initial inverse Hessian is that of the local/global iteration,
+         // i.e., (2L)^-1 applied to x and y separately
+         factorLaplacian(t);
+         
+         DenseMatrix<Real> x, g, d, xPrev, gPrev;
+         getPositions(mesh, x);
+         
+         std::deque< DenseMatrix<Real> > S, Y;
+         std::deque<double> rho;
+         
+         double res = 0.;
+         int iter;
+         for( iter = 0; iter < max_iters; iter++ )
          {
-            // edge vectors from A
-            VertexIter v0 = fA->he->vertex;
-            VertexIter v1 = fA->he->next->vertex;
-            VertexIter v2 = fA->he->next->next->vertex;
+            res = energy.gradient(x, g);
+            reportIteration(iter, res);
+            if (res < tolerance) break;
             
-            Vector e01 = v1->position - v0->position;
-            Vector e12 = v2->position - v1->position;
-
-            DenseMatrix<Real> A0(2,2);
-            A0(0,0) = e01.x; A0(0,1) = e12.x;
-            A0(1,0) = e01.y; A0(1,1) = e12.y;
+            if( iter > 0 )
+            {
+               // update the curvature pairs, skipping pairs that would
+               // make the approximation indefinite
+               DenseMatrix<Real> s = x - xPrev;
+               DenseMatrix<Real> y = g - gPrev;
+               double ys = dot(y, s);
+               if( ys > 0. )
+               {
+                  S.push_back(s); Y.push_back(y); rho.push_back(1./ys);
+                  if( (int) rho.size() > history )
+                  {
+                     S.pop_front(); Y.pop_front(); rho.pop_front();
+                  }
+               }
+            }
             
-            // edge vectors from B
-            v0 = fB->he->vertex;
-            v1 = fB->he->next->vertex;
-            v2 = fB->he->next->next->vertex;
+            // two-loop recursion
+            int m = rho.size();
+            std::vector<double> alpha(m);
+            DenseMatrix<Real> q = g;
+            for( int k = m-1; k >= 0; k-- )
+            {
+               alpha[k] = rho[k] * dot(S[k], q);
+               q -= Real(alpha[k]) * Y[k];
+            }
             
-            e01 = v1->position - v0->position;
-            e12 = v2->position - v1->position;
+            DenseMatrix<Real> r;
+            preconditionGradient(q, r);
+            q = r;
             
-            DenseMatrix<Real> A1(2,2);
-            A1(0,0) = e01.x; A1(0,1) = e12.x;
-            A1(1,0) = e01.y; A1(1,1) = e12.y;
+            for( int k = 0; k < m; k++ )
+            {
+               double beta = rho[k] * dot(Y[k], q);
+               q += Real(alpha[k] - beta) * S[k];
+            }
+            d = -q;
             
-            // ortho(A1*inv(A0))
-            DenseMatrix<Real> M = A1 * PolarDecomposition2x2::invert(A0);
-            Complex z = PolarDecomposition2x2::extractOrthogonalPart(M);
-            angle(fA->index,0) = z;
+            xPrev = x;
+            gPrev = g;
+            if( lineSearch(x, g, d) == 0. )
+            {
+               // the approximation is no good any more; restart from
+               // the preconditioned gradient, unless that is what failed
+               if( m == 0 )
+               {
+                  reportStall("L-BFGS", iter, res);
+                  break;
+               }
+               S.clear(); Y.clear(); rho.clear();
+            }
+         }
+         
+         assignPositions(x, mesh);
+         recordSolve(iter, res);
+         return iter;
+      }
+      
+      void preconditionGradient(const DenseMatrix<Real>& g,
+                                DenseMatrix<Real>& d)
+      // applies the inverse Hessian of the local/global iteration, (2L)^-1,
+      // to the x and y coordinates of g; requires factorLaplacian()
+      {
+         int n = g.nRows();
+         DenseMatrix<Complex> gc(n/2, 1), dc;
+         for( int i = 0; i < n/2; i++ )
+         {
+            gc(i) = Complex(g(2*i), g(2*i+1));
+         }
+         backsolvePositiveDefinite(LL, dc, gc);
+         d = DenseMatrix<Real>(n, 1);
+         for( int i = 0; i < n/2; i++ )
+         {
+            d(2*i+0) = 0.5*dc(i).re;
+            d(2*i+1) = 0.5*dc(i).im;
+         }
+      }
+      
+      bool refactorQuietly(SparseMatrix<Real>& H)
+      // factors H into HH; an indefinite H is expected here, so CHOLMOD's
+      // warning about it is suppressed
+      {
+         cholmod_common* common = context;
+         int print = common->print;
+         common->print = 0;
+         bool ok = HH.refactor(H);
+         common->print = print;
+         return ok;
+      }
+      
+      void reportIteration(int iter, double res) const
+      {
+         if( !telemetry.quiet() )
+         {
+            std::cout << "Iter" << iter << ": res = " << res << std::endl;
+         }
+      }
+      
+      void reportStall(const char* method, int iter, double res) const
+      {
+         std::cerr << "Warning: " << method << " iteration " << iter
+                   << " made no progress (res = " << res << ")" << std::endl;
+      }
+      
+      void recordSolve(int iter, double res) const
+      {
+         telemetry.record("elasticity.iterations", iter);
+         telemetry.record("elasticity.residual", res);
+      }
+      
+      double lineSearch(DenseMatrix<Real>& x,
+                        const DenseMatrix<Real>& g,
+                        const DenseMatrix<Real>& dx,
+                        int max_steps = 30) const
+      // moves x along dx, halving the step until the energy decreases
+      // sufficiently (Armijo condition); returns the step size taken
+      {
+         const double c = 1e-4;
+         double E0 = energy.value(x);
+         double slope = dot(g, dx);
+         
+         // once the predicted decrease drops below the precision of E,
+         // the test is meaningless and the full step is taken
+         if( -slope <= 1e-12*fabs(E0) )
+         {
+            x += dx;
+            return 1.;
          }
+         
+         double step = 1.;
+         for( int i = 0; i < max_steps; i++ )
+         {
+            DenseMatrix<Real> y = x + Real(step)*dx;
+            if( energy.value(y) <= E0 + c*step*slope )
+            {
+               x = y;
+               return step;
+            }
+            step *= 0.5;
+         }
+         return 0.;
+      }
+      
+      void computeRotation(const Mesh& meshA,
+                           const Mesh& meshB,
+                           DenseMatrix<Complex>& angle) const
+      {
+         int nF = meshA.faces.size();
+         angle = DenseMatrix<Complex>(nF,1);
+
+         // faces are independent, so split them among threads
+         parallelFor( 0, nF, [&]( int begin, int end )
+         {
+            for( int i = begin; i < end; i++ )
+            {
+               const Face& fA = meshA.faces[i];
+               const Face& fB = meshB.faces[i];
+
+               // edge vectors from A
+               Vector pA0 = fA.he->vertex->position;
+               Vector pA1 = fA.he->next->vertex->position;
+               Vector pA2 = fA.he->next->next->vertex->position;
+
+               // edge vectors from B
+               Vector pB0 = fB.he->vertex->position;
+               Vector pB1 = fB.he->next->vertex->position;
+               Vector pB2 = fB.he->next->next->vertex->position;
+
+               // ortho(A1*inv(A0))
+               angle(fA.index,0) = PolarDecomposition2x2::faceRotation( pA1-pA0, pA2-pA1,
+                                                                        pB1-pB0, pB2-pB1 );
+            }
+         });
       }
       
       void computeLaplacian(const Mesh& mesh,
@@ -145,27 +500,22 @@ namespace DDG
                              DenseMatrix<Complex>& rhs) const
       {
          rhs = DenseMatrix<Complex>(mesh.vertices.size(),1);
-         for( VertexCIter v = mesh.vertices.begin();
-             v != mesh.vertices.end();
-             v ++ )
+         const MeshAdjacency& adjacency( mesh.adjacency() );
+         forEachVertexOneRing( adjacency, [&]( int i, int begin, int end )
          {
             Complex sum;
-            // Vector pi = v->position;
-            HalfEdgeIter he = v->he;
-            do
+            for( int k = begin; k < end; k++ )
             {
-               if( not he->onBoundary )
-               {
-                  Vector area_grad = 0.5*he->next->rotatedEdge();
-                  Complex sum_ijk( area_grad.x, area_grad.y );
-                  Complex Rijk = angle(he->face->index, 0);
-                  sum += Rijk * sum_ijk;
-               }
-               he = he->flip->next;
+               int f = adjacency.face[k];
+               if( f < 0 ) continue;
+
+               Vector area_grad = 0.5*mesh.halfedges[ adjacency.next[k] ].rotatedEdge();
+               Complex sum_ijk( area_grad.x, area_grad.y );
+               Complex Rijk = angle(f, 0);
+               sum += Rijk * sum_ijk;
             }
-            while( he != v->he );
-            rhs(v->index,0) = sum;
-         }
+            rhs(i,0) = sum;
+         });
       }
       
       void assign2DPositions(const DenseMatrix<Complex>& x, Mesh& mesh)
@@ -177,6 +527,42 @@ namespace DDG
             Complex xi = x(v->index,0);
             v->position = Vector(xi.re, xi.im, 0.);
          }
+         mesh.invalidateGeometry();
+      }
+      
+      void assignPositions(const DenseMatrix<Real>& x, Mesh& mesh)
+      // assigns interleaved positions (x_0, y_0, x_1, y_1, ...), centered
+      // at the origin like the solution of the local/global iteration
+      {
+         int nV = mesh.vertices.size();
+         double cx = 0., cy = 0.;
+         for( int i = 0; i < nV; i++ )
+         {
+            cx += x(2*i+0);
+            cy += x(2*i+1);
+         }
+         cx /= nV; cy /= nV;
+         
+         for( VertexIter v = mesh.vertices.begin();
+             v != mesh.vertices.end();
+             v ++ )
+         {
+            v->position = Vector(x(2*v->index+0) - cx, x(2*v->index+1) - cy, 0.);
+         }
+         mesh.invalidateGeometry();
+      }
+      
+      void getPositions(const Mesh& mesh, DenseMatrix<Real>& x) const
+      // gets interleaved positions (x_0, y_0, x_1, y_1, ...)
+      {
+         x = DenseMatrix<Real>(2*mesh.vertices.size(),1);
+         for( VertexCIter v = mesh.vertices.begin();
+             v != mesh.vertices.end();
+             v ++ )
+         {
+            x(2*v->index+0) = v->position.x;
+            x(2*v->index+1) = v->position.y;
+         }
       }
       
       void get2DPositions(const Mesh& mesh, DenseMatrix<Complex>& x) const
@@ -0,0 +1,323 @@
+// -----------------------------------------------------------------------------
+// libDDG -- ElasticEnergy.h
+// -----------------------------------------------------------------------------
+//
+// ElasticEnergy is the as-rigid-as-possible energy minimized by the
+// interpolation between two planar shapes,
+//
+//    E(x) = sum_f (1-t) A_f |J_f - R(J_f)|^2 + t A'_f |J'_f - R(J'_f)|^2,
+//
+// where J_f (J'_f) is the deformation gradient of face f relative to the
+// source (target) shape, A_f (A'_f) its rest area, and R(J) the rotation
+// closest to J.  Vertex positions are stored as a real vector
+// x = (x_0, y_0, x_1, y_1, ...).
+//
+// Besides value and gradient, the energy provides its Hessian for Newton's
+// method.  The Hessian of |J - R(J)|^2 with respect to J is 2 on every
+// direction except the "twist" T = R [0 -1; 1 0]/sqrt(2), where it is
+// 2(1 - 2/tr(R^T J)).  This eigenvalue is negative for compressed triangles;
+// clamping it at zero gives a positive semidefinite ("projected") Hessian,
+// which is exact wherever the triangle is stretched.
+//
+
+#ifndef DDG_ELASTICENERGY_H
+#define DDG_ELASTICENERGY_H
+
+#include <cmath>
+#include <vector>
+
+#include "Mesh.h"
+#include "DenseMatrix.h"
+#include "SparseMatrix.h"
+
+namespace DDG
+{
+   class ElasticEnergy
+   {
+   public:
+      ElasticEnergy( void )
+      // constructs an empty energy
+      {}
+
+      ElasticEnergy( double t, const Mesh& source, const Mesh& target )
+      // sets up the energy of the interpolant at time t
+      {
+         build( source, target );
+         setTime( t );
+      }
+
+      void build( const Mesh& source, const Mesh& target )
+      // sets up the elements of source and target, which must have the same
+      // connectivity; the energy is that of t = 0 until setTime() is called
+      {
+         int nF = source.faces.size();
+         elements.clear();
+         elements.reserve( 2*nF );
+         for( int i = 0; i < nF; i++ )
+         {
+            addElement( source.faces[i], false );
+            addElement( target.faces[i], true  );
+         }
+
+         mass.assign( source.vertices.size(), 0. );
+         slots.clear();
+         setTime( 0. );
+      }
+
+      void setTime( double t )
+      // sets the interpolation parameter; does not change the sparsity
+      // pattern of the Hessian
+      {
+         mass.assign( mass.size(), 0. );
+         for( size_t k = 0; k < elements.size(); k++ )
+         {
+            Element& e( elements[k] );
+            e.weight = ( e.onTarget ? t : 1.-t ) * e.area;
+            for( int a = 0; a < 3; a++ )
+            {
+               mass[ e.v[a] ] += e.weight / 3.;
+            }
+         }
+      }
+
+      int size( void ) const
+      // returns the number of degrees of freedom
+      {
+         return 2*mass.size();
+      }
+
+      double value( const DenseMatrix<Real>& x ) const
+      // returns the energy of positions x
+      {
+         double E = 0.;
+         for( size_t k = 0; k < elements.size(); k++ )
+         {
+            Local l( elements[k], x );
+            E += l.value;
+         }
+         return E;
+      }
+
+      double gradient( const DenseMatrix<Real>& x,
+                             DenseMatrix<Real>& g ) const
+      // computes the gradient g of the energy at x and returns its magnitude
+      // relative to the rotational part of the gradient, which is the same
+      // measure as the residual of the local/global iteration
+      {
+         int n = size();
+         g = DenseMatrix<Real>( n, 1 );
+         DenseMatrix<Real> f( n, 1 );
+
+         for( size_t k = 0; k < elements.size(); k++ )
+         {
+            const Element& e( elements[k] );
+            Local l( e, x );
+            double w2 = 2.*e.weight;
+
+            for( int a = 0; a < 3; a++ )
+            for( int r = 0; r < 2; r++ )
+            {
+               double dJ = 0., dR = 0.;
+               for( int c = 0; c < 2; c++ )
+               {
+                  dJ += l.J[r][c] * e.G[a][c];
+                  dR += l.R[r][c] * e.G[a][c];
+               }
+               g( 2*e.v[a]+r ) += w2 * ( dJ - dR );
+               f( 2*e.v[a]+r ) += w2 * dR;
+            }
+         }
+
+         double fNorm = f.norm();
+         return fNorm > 0. ? g.norm() / fNorm : g.norm();
+      }
+
+      SparseMatrix<Real>& hessian( const DenseMatrix<Real>& x,
+                                   bool project = true )
+      // assembles and returns the Hessian at x, projected onto positive
+      // semidefinite matrices per element if project is true; the sparsity
+      // pattern of the Hessian is the same for all x (and all t), so it can
+      // be refactored without a new symbolic analysis
+      {
+         if( slots.empty() ) buildPattern();
+         H.zero( 0. );
+
+         Real** slot = &slots[0];
+         for( size_t k = 0; k < elements.size(); k++ )
+         {
+            const Element& e( elements[k] );
+            Local l( e, x );
+            double w2 = 2.*e.weight;
+
+            // twist direction T = R [0 -1; 1 0]/sqrt(2), pulled back to the vertices
+            double tc = l.R[0][0] / sqrt( 2. );
+            double ts = l.R[1][0] / sqrt( 2. );
+            double T[2][2] = { { -ts, -tc },
+                               {  tc, -ts } };
+            double q[3][2];
+            for( int a = 0; a < 3; a++ )
+            for( int r = 0; r < 2; r++ )
+            {
+               q[a][r] = T[r][0]*e.G[a][0] + T[r][1]*e.G[a][1];
+            }
+
+            double lambda = l.trace > 0. ? w2*( 1. - 2./l.trace ) : 0.;
+            if( project && lambda < 0. ) lambda = 0.;
+            double twist = lambda - w2;
+
+            for( int a = 0; a < 3; a++ )
+            for( int b = 0; b < 3; b++ )
+            {
+               double GaGb = e.G[a][0]*e.G[b][0] + e.G[a][1]*e.G[b][1];
+               for( int r = 0; r < 2; r++ )
+               for( int s = 0; s < 2; s++ )
+               {
+                  double h = twist * q[a][r] * q[b][s];
+                  if( r == s ) h += w2 * GaGb;
+                  **slot++ += h;
+               }
+            }
+         }
+
+         // rigid motions lie in the null space; add the same small
+         // regularization as the Laplacian of the local/global iteration
+         for( size_t i = 0; i < mass.size(); i++ )
+         {
+            **slot++ += 2e-8*mass[i];
+            **slot++ += 2e-8*mass[i];
+         }
+
+         return H;
+      }
+
+   protected:
+      void buildPattern( void )
+      // creates all entries of the Hessian and records where each element
+      // writes; entries of a SparseMatrix never move once created, so the
+      // assembly does not need to search for them again
+      {
+         int n = size();
+         H.resize( n, n );
+         slots.clear();
+         slots.reserve( 36*elements.size() + n );
+
+         for( size_t k = 0; k < elements.size(); k++ )
+         {
+            const Element& e( elements[k] );
+            for( int a = 0; a < 3; a++ )
+            for( int b = 0; b < 3; b++ )
+            for( int r = 0; r < 2; r++ )
+            for( int s = 0; s < 2; s++ )
+            {
+               slots.push_back( &H( 2*e.v[a]+r, 2*e.v[b]+s ) );
+            }
+         }
+
+         for( int i = 0; i < n; i++ )
+         {
+            slots.push_back( &H( i, i ) );
+         }
+      }
+
+      struct Element
+      {
+         int v[3];
+         // vertex indices
+
+         double G[3][2];
+         // J = sum_a x_a G_a^T, where x_a are the positions of the corners
+
+         double area;
+         // rest area
+
+         bool onTarget;
+         // true if the rest shape is the target, false if it is the source
+
+         double weight;
+         // interpolation weight times rest area
+      };
+
+      struct Local
+      // deformation gradient, closest rotation and energy of an element
+      {
+         Local( const Element& e, const DenseMatrix<Real>& x )
+         {
+            for( int r = 0; r < 2; r++ )
+            for( int c = 0; c < 2; c++ )
+            {
+               J[r][c] = 0.;
+               for( int a = 0; a < 3; a++ )
+               {
+                  J[r][c] += x( 2*e.v[a]+r ) * e.G[a][c];
+               }
+            }
+
+            // in 2D the closest rotation is proportional to J + cof(J)
+            double zr = J[0][0] + J[1][1];
+            double zi = J[1][0] - J[0][1];
+            trace = sqrt( zr*zr + zi*zi );
+            double c = 1., s = 0.;
+            if( trace > 0. ) { c = zr/trace; s = zi/trace; }
+            R[0][0] = c; R[0][1] = -s;
+            R[1][0] = s; R[1][1] =  c;
+
+            double J2 = J[0][0]*J[0][0] + J[0][1]*J[0][1] +
+                        J[1][0]*J[1][0] + J[1][1]*J[1][1];
+            value = e.weight * ( J2 - 2.*trace + 2. );
+         }
+
+         double J[2][2];
+         double R[2][2];
+         double trace;
+         // tr(R^T J)
+
+         double value;
+      };
+
+      void addElement( const Face& f, bool onTarget )
+      {
+         HalfEdgeCIter he = f.he;
+         Element e;
+         e.v[0] = he->vertex->index;
+         e.v[1] = he->next->vertex->index;
+         e.v[2] = he->next->next->vertex->index;
+
+         Vector p0 = he->vertex->position;
+         Vector p1 = he->next->vertex->position;
+         Vector p2 = he->next->next->vertex->position;
+         Vector a01 = p1-p0;
+         Vector a12 = p2-p1;
+
+         // J = [x1-x0 x2-x1] inv([a01 a12])
+         double detA = a01.x*a12.y - a12.x*a01.y;
+         double D[2][2] = { {  a12.y/detA, -a12.x/detA },
+                            { -a01.y/detA,  a01.x/detA } };
+         for( int c = 0; c < 2; c++ )
+         {
+            e.G[0][c] = -D[0][c];
+            e.G[1][c] =  D[0][c] - D[1][c];
+            e.G[2][c] =  D[1][c];
+         }
+         e.area = 0.5 * fabs( detA );
+         e.onTarget = onTarget;
+         e.weight = 0.;
+         elements.push_back( e );
+      }
+
+      std::vector<Element> elements;
+      // one element per face and rest shape
+
+      std::vector<double> mass;
+      // weighted barycentric vertex areas
+
+      SparseMatrix<Real> H;
+      std::vector<Real*> slots;
+      // Hessian and the location of each element's contributions
+
+      ElasticEnergy( const ElasticEnergy& );
+      const ElasticEnergy& operator=( const ElasticEnergy& );
+      // slots point into H, so the energy cannot be copied
+   };
+}
+
+#endif
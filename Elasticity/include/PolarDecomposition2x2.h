@@ -3,24 +3,46 @@
 
 #include "Complex.h"
 #include "DenseMatrix.h"
+#include "Vector.h"
 
 namespace DDG
 {
    class PolarDecomposition2x2
    {
    public:
-      static Complex extractOrthogonalPart(DenseMatrix<Real> A)
+      static Complex rotation(double a, double b,
+                              double c, double d)
+      // returns the orthogonal factor of [a b; c d] as the unit complex
+      // number given by its first column; in 2D the factor is proportional
+      // to A + sign(det A) cof(A), so no iteration is needed
       {
-         double res = 1.0;
-         while( res > 1.0e-6 )
-         {
-            DenseMatrix<Real> B = Real(0.5)*( A + invert(A.transpose()) );
-            res = (A - B).norm( lTwo );
-            A = B;
-         }
-         return Complex( A(0,0), A(1,0) ).unit();
+         double detA = a*d - b*c;
+         Complex z = ( detA >= 0. ) ? Complex( a+d, c-b )
+                                    : Complex( a-d, c+b );
+         return z.unit();
       }
-      
+
+      static Complex faceRotation(const Vector& a01, const Vector& a12,
+                                  const Vector& b01, const Vector& b12)
+      // returns ortho(B*inv(A)), where the columns of A and B are the
+      // (planar) edge vectors of a triangle before and after deformation
+      {
+         double detA = a01.x*a12.y - a12.x*a01.y;
+
+         // B*adj(A)/det(A)
+         double m00 = (  b01.x*a12.y - b12.x*a01.y ) / detA;
+         double m01 = ( -b01.x*a12.x + b12.x*a01.x ) / detA;
+         double m10 = (  b01.y*a12.y - b12.y*a01.y ) / detA;
+         double m11 = ( -b01.y*a12.x + b12.y*a01.x ) / detA;
+
+         return rotation( m00, m01, m10, m11 );
+      }
+
+      static Complex extractOrthogonalPart(const DenseMatrix<Real>& A)
+      {
+         return rotation( A(0,0), A(0,1), A(1,0), A(1,1) );
+      }
+
       static DenseMatrix<Real> invert(const DenseMatrix<Real>& A)
       {
          double detA = A(0,0)*A(1,1) - A(0,1)*A(1,0);
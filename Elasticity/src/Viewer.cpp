@@ -450,6 +450,8 @@ namespace DDG
    
    void Viewer :: drawPolygons( const Mesh& surf )
    {
+      const MeshGeometry& geometry( surf.geometry() );
+
       for( FaceCIter f  = surf.faces.begin();
           f != surf.faces.end();
           f ++ )
@@ -459,7 +461,7 @@ namespace DDG
          glBegin( GL_POLYGON );
          if( renderWireframe )
          {
-            Vector N = f->normal();
+            Vector N = geometry.normal( f );
             glNormal3dv( &N[0] );
          }
          
@@ -468,7 +470,7 @@ namespace DDG
          {
             if( not renderWireframe )
             {
-               Vector N = he->vertex->normal();
+               Vector N = geometry.normal( he->vertex );
                glNormal3dv( &N[0] );
             }
             
@@ -0,0 +1,53 @@
+// Headless driver: smooths a mesh by implicit mean curvature flow and writes
+// the result without opening a window (nothing here depends on OpenGL).
+// Build with "make cli".
+
+#include <iostream>
+using namespace std;
+
+#include "CommandLine.h"
+#include "Mesh.h"
+#include "Telemetry.h"
+#include "Application.h"
+using namespace DDG;
+
+namespace DDG
+{
+   extern Telemetry telemetry;
+}
+
+int main( int argc, char** argv )
+{
+   CommandLine args( argc, argv );
+   if( args.nPositional() != 1 )
+   {
+      cerr << "usage: " << args.program() << " in.obj"
+           << " [--step=0.01] [--steps=1] [--linearized] [--out=out.obj]"
+           << " [--quiet] [--telemetry=stats.json]" << endl;
+      return 1;
+   }
+   telemetry.setQuiet( args.has( "quiet" ));
+
+   Mesh mesh;
+   Timer timer;
+   if( mesh.read( args.positional( 0 ))) return 1;
+   telemetry.record( "cli.load", timer.elapsed() );
+   telemetry.print( "cli", "load", timer.elapsed(), "s" );
+
+   timer.start();
+   Application app;
+   if( !app.run( args.value( "step", 0.01 ), mesh,
+                 args.value( "steps", 1 ), args.has( "linearized" )))
+   {
+      return 1;
+   }
+   telemetry.record( "cli.run", timer.elapsed() );
+   telemetry.print( "cli", "run", timer.elapsed(), "s" );
+
+   timer.start();
+   if( mesh.write( args.value( "out", "out.obj" ))) return 1;
+   telemetry.record( "cli.write", timer.elapsed() );
+   telemetry.print( "cli", "write", timer.elapsed(), "s" );
+
+   return args.writeTelemetry();
+}
@@ -7,40 +7,81 @@
 #ifndef DDG_APPLICATION_H
 #define DDG_APPLICATION_H
 
+#include <iostream>
+
 #include "Mesh.h"
 #include "Real.h"
 #include "DenseMatrix.h"
 #include "SparseMatrix.h"
 #include "DiscreteExteriorCalculus.h"
+#include "Telemetry.h"
 
 namespace DDG
 {
    class Application
    {
    public:
-      void run(const double step, Mesh& mesh)
+      bool run(const double step, Mesh& mesh)
+      {
+         return run(step, mesh, 1);
+      }
+      
+      bool run(const double step, Mesh& mesh, int nSteps, bool linearized = false)
+      // takes nSteps backward Euler steps of mean curvature flow.  The
+      // symbolic factorization of star0 + step*L is computed only once, since
+      // its pattern depends only on connectivity; if linearized is true, L
+      // and star0 are also frozen at the initial surface, so that every step
+      // after the first is a single backsolve.  Returns false (leaving the
+      // mesh at the last good step) if star0 + step*L cannot be factored,
+      // e.g., because of degenerate faces
+      {
+         DenseMatrix<Real> x;
+         getPositions(mesh, x);
+         
+         for( int i = 0; i < nSteps; i++ )
+         {
+            ScopedTimer timer( telemetry, "fairing.step" );
+            if( i == 0 || !linearized )
+            {
+               buildOperators(mesh);
+               A = star0 + Real(step) * L;
+               if( !AA.refactor(A) )
+               {
+                  std::cerr << "Error: star0 + step*L is not positive definite"
+                            << " at step " << i << std::endl;
+                  return false;
+               }
+            }
+            
+            DenseMatrix<Real> rhs = star0 * x;
+            backsolvePositiveDefinite(AA, x, rhs);
+            setPositions(x, mesh);
+         }
+         return true;
+      }
+      
+   protected:
+      SparseMatrix<Real> star0;
+      SparseMatrix<Real> L;
+      // mass matrix and cotan Laplacian of the current surface
+      
+      SparseMatrix<Real> A;
+      SparseFactor<Real> AA;
+      // system matrix star0 + step*L and its factor
+      
+      void buildOperators(const Mesh& mesh)
       {
-         SparseMatrix<Real> star0;
          HodgeStar0Form<Real>::build( mesh, star0 );
-
+         
          SparseMatrix<Real> star1;
          HodgeStar1Form<Real>::build( mesh, star1 );
          
          SparseMatrix<Real> d0;
          ExteriorDerivative0Form<Real>::build( mesh, d0 );
          
-         SparseMatrix<Real> L = d0.transpose() * star1 * d0;
-         SparseMatrix<Real> A = star0 + Real(step) * L;
-         
-         DenseMatrix<Real> x;
-         getPositions(mesh, x);
-         DenseMatrix<Real> rhs = star0 * x;
-         
-         solvePositiveDefinite(A, x, rhs);
-         setPositions(x, mesh);
+         L = d0.transpose() * star1 * d0;
       }
       
-   protected:
       void getPositions(const Mesh& mesh, DenseMatrix<Real>& x) const
       {
          x = DenseMatrix<Real>( mesh.vertices.size(), 3 );
@@ -63,6 +104,7 @@ namespace DDG
                                  x(v->index, 1),
                                  x(v->index, 2));
          }
+         mesh.invalidateGeometry();
       }
    };
 }
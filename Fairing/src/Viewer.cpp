@@ -408,6 +408,8 @@ namespace DDG
    
    void Viewer :: drawPolygons( void )
    {
+      const MeshGeometry& geometry( mesh.geometry() );
+
       for( FaceCIter f  = mesh.faces.begin();
           f != mesh.faces.end();
           f ++ )
@@ -417,7 +419,7 @@ namespace DDG
          glBegin( GL_POLYGON );
          if( renderWireframe )
          {
-            Vector N = f->normal();
+            Vector N = geometry.normal( f );
             glNormal3dv( &N[0] );
          }
          
@@ -426,7 +428,7 @@ namespace DDG
          {
             if( not renderWireframe )
             {
-               Vector N = he->vertex->normal();
+               Vector N = geometry.normal( he->vertex );
                glNormal3dv( &N[0] );
             }
             
@@ -0,0 +1,41 @@
+// Benchmark driver: times the core stages of libDDG and conformal
+// parameterization on synthetic meshes (see Benchmark.h for options).  Build
+// with "make bench".
+
+#include <iostream>
+using namespace std;
+
+#include "CommandLine.h"
+#include "Benchmark.h"
+#include "Mesh.h"
+#include "Telemetry.h"
+#include "Application.h"
+using namespace DDG;
+
+int main( int argc, char** argv )
+{
+   CommandLine args( argc, argv );
+   Benchmark bench( args );
+
+   for( int i = 0; i < bench.nCases(); i++ )
+   {
+      Mesh mesh;
+      if( bench.load( i, mesh )) return 1;
+      bench.runCore( i, mesh );
+
+      // only meshes with boundary can be flattened
+      if( !bench.hasBoundary( i )) continue;
+
+      for( int r = 0; r < bench.repeat(); r++ )
+      {
+         if( mesh.reload() ) return 1;
+
+         Timer timer;
+         Application app;
+         app.run( mesh );
+         bench.record( i, "app", timer.elapsed() );
+      }
+   }
+
+   return bench.finish();
+}
@@ -0,0 +1,64 @@
+// Headless driver: computes a conformal parameterization of a disk-like mesh
+// and writes the texture coordinates without opening a window (nothing here
+// depends on OpenGL).  Build with "make cli".
+
+#include <iostream>
+#include <vector>
+using namespace std;
+
+#include "CommandLine.h"
+#include "Mesh.h"
+#include "Telemetry.h"
+#include "Application.h"
+using namespace DDG;
+
+namespace DDG
+{
+   extern Telemetry telemetry;
+}
+
+int main( int argc, char** argv )
+{
+   CommandLine args( argc, argv );
+   if( args.nPositional() != 1 )
+   {
+      cerr << "usage: " << args.program() << " in.obj"
+           << " [--uv=uv.txt] [--out=out.obj]"
+           << " [--quiet] [--telemetry=stats.json]" << endl;
+      return 1;
+   }
+   telemetry.setQuiet( args.has( "quiet" ));
+
+   Mesh mesh;
+   Timer timer;
+   if( mesh.read( args.positional( 0 ))) return 1;
+   telemetry.record( "cli.load", timer.elapsed() );
+   telemetry.print( "cli", "load", timer.elapsed(), "s" );
+
+   timer.start();
+   Application app;
+   app.run( mesh );
+   telemetry.record( "cli.run", timer.elapsed() );
+   telemetry.print( "cli", "run", timer.elapsed(), "s" );
+
+   timer.start();
+   vector<double> uv;
+   uv.reserve( 2*mesh.vertices.size() );
+   for( VertexCIter v = mesh.vertices.begin(); v != mesh.vertices.end(); v++ )
+   {
+      uv.push_back( v->texture.x );
+      uv.push_back( v->texture.y );
+   }
+   if( CommandLine::writeValues( args.value( "uv", "uv.txt" ), uv, 2 )) return 1;
+
+   // the OBJ writer takes texture coordinates from the halfedges
+   for( HalfEdgeIter he = mesh.halfedges.begin(); he != mesh.halfedges.end(); he++ )
+   {
+      he->texcoord = he->vertex->texture;
+   }
+   if( mesh.write( args.value( "out", "out.obj" ))) return 1;
+   telemetry.record( "cli.write", timer.elapsed() );
+   telemetry.print( "cli", "write", timer.elapsed(), "s" );
+
+   return args.writeTelemetry();
+}
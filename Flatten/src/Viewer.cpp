@@ -409,6 +409,8 @@ namespace DDG
    
    void Viewer :: drawPolygons( void )
    {
+      const MeshGeometry& geometry( mesh.geometry() );
+
       if( not renderQuasiConformal )
       {
          glColor3d( 1., .5, .25 );
@@ -430,7 +432,7 @@ namespace DDG
          glBegin( GL_POLYGON );
          if( render3D and renderWireframe )
          {
-            Vector N = f->normal();
+            Vector N = geometry.normal( f );
             glNormal3dv( &N[0] );
          }
          
@@ -439,7 +441,7 @@ namespace DDG
          {
             if( render3D and (not renderWireframe) )
             {
-               Vector N = he->vertex->normal();
+               Vector N = geometry.normal( he->vertex );
                glNormal3dv( &N[0] );
             }
 
@@ -0,0 +1,69 @@
+// Headless driver: computes geodesic distance from a set of source vertices
+// with the heat method and writes it without opening a window (nothing here
+// depends on OpenGL).  Build with "make cli".
+
+#include <iostream>
+#include <vector>
+using namespace std;
+
+#include "CommandLine.h"
+#include "Mesh.h"
+#include "Telemetry.h"
+#include "Application.h"
+using namespace DDG;
+
+namespace DDG
+{
+   extern Telemetry telemetry;
+}
+
+int main( int argc, char** argv )
+{
+   CommandLine args( argc, argv );
+   if( args.nPositional() != 1 )
+   {
+      cerr << "usage: " << args.program() << " in.obj"
+           << " [--sources=0,...] [--step=1] [--distance=distance.txt] [--out=out.obj]"
+           << " [--quiet] [--telemetry=stats.json]" << endl;
+      return 1;
+   }
+   telemetry.setQuiet( args.has( "quiet" ));
+
+   Mesh mesh;
+   Timer timer;
+   if( mesh.read( args.positional( 0 ))) return 1;
+   telemetry.record( "cli.load", timer.elapsed() );
+   telemetry.print( "cli", "load", timer.elapsed(), "s" );
+
+   vector<int> sources = args.indices( "sources" );
+   if( sources.empty() ) sources.push_back( 0 );
+   for( size_t i = 0; i < sources.size(); i++ )
+   {
+      if( sources[i] < 0 || sources[i] >= (int) mesh.vertices.size() )
+      {
+         cerr << "Error: vertex " << sources[i] << " does not exist" << endl;
+         return 1;
+      }
+      mesh.vertices[ sources[i] ].tag = true;
+   }
+
+   timer.start();
+   Application app;
+   app.run( args.value( "step", 1. ), mesh );
+   telemetry.record( "cli.run", timer.elapsed() );
+   telemetry.print( "cli", "run", timer.elapsed(), "s" );
+
+   timer.start();
+   vector<double> distance;
+   distance.reserve( mesh.vertices.size() );
+   for( VertexCIter v = mesh.vertices.begin(); v != mesh.vertices.end(); v++ )
+   {
+      distance.push_back( v->distance );
+   }
+   if( CommandLine::writeValues( args.value( "distance", "distance.txt" ), distance )) return 1;
+   if( mesh.write( args.value( "out", "out.obj" ))) return 1;
+   telemetry.record( "cli.write", timer.elapsed() );
+   telemetry.print( "cli", "write", timer.elapsed(), "s" );
+
+   return args.writeTelemetry();
+}
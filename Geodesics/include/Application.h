@@ -116,25 +116,21 @@ namespace DDG
       void computeDivergence(const Mesh& mesh, DenseMatrix<Real>& div) const
       {
          div = DenseMatrix<Real>(mesh.vertices.size());
-         for( VertexCIter v = mesh.vertices.begin();
-             v != mesh.vertices.end();
-             v ++)
+         const MeshAdjacency& adjacency( mesh.adjacency() );
+         forEachVertexOneRing( adjacency, [&]( int i, int begin, int end )
          {
             double sum = 0.0;
-            HalfEdgeIter he = v->he;
-            do
+            for( int k = begin; k < end; k++ )
             {
-               if( not he->onBoundary )
-               {
-                  Vector n = he->next->rotatedEdge();
-                  Vector v = he->face->vector;
-                  sum += dot( n, v );
-               }
-               he = he->flip->next;
+               int f = adjacency.face[k];
+               if( f < 0 ) continue;
+
+               Vector n = mesh.halfedges[ adjacency.next[k] ].rotatedEdge();
+               Vector v = mesh.faces[f].vector;
+               sum += dot( n, v );
             }
-            while( he != v->he );
-            div(v->index) = sum;
-         }
+            div(i) = sum;
+         });
       }
       
       void assignDistance(const DenseMatrix<Real>& phi, Mesh& mesh)
@@ -9,9 +9,13 @@ using namespace std;
 namespace DDG
 {
    Mesh :: Mesh( void )
+   : geometryIsValid( false ),
+     adjacencyIsValid( false )
    {}
    
    Mesh :: Mesh( const Mesh& mesh )
+   : geometryIsValid( false ),
+     adjacencyIsValid( false )
    {
       *this = mesh;
    }
@@ -65,6 +69,8 @@ namespace DDG
       for(   EdgeIter e =    edges.begin(); e !=    edges.end(); e++ ) e->he = halfedgeOldToNew[ e->he ];
       for(   FaceIter f =    faces.begin(); f !=    faces.end(); f++ ) f->he = halfedgeOldToNew[ f->he ];
       
+      invalidateConnectivity();
+      
       return *this;
    }
    
@@ -79,6 +85,8 @@ namespace DDG
          return 1;
       }
       
+      invalidateGeometry();
+      
       int rval;
       if( !( rval = MeshIO::read( in, *this )))
       {
@@ -136,6 +144,8 @@ namespace DDG
       {
          v->position /= rMax;
       }
+      
+      invalidateGeometry();
    }
    
    void Mesh::indexElements( void )
@@ -160,6 +170,8 @@ namespace DDG
          f->index = nF;
          nF++;
       }
+
+      adjacencyIsValid = false;
    }
    
    double Mesh::area( void ) const
@@ -187,5 +199,45 @@ namespace DDG
       }
       return sum / edges.size();
    }
+   
+   const MeshGeometry& Mesh::geometry( void ) const
+   {
+      if( !geometryIsValid )
+      {
+         cachedGeometry.build( *this );
+         geometryIsValid = true;
+      }
+      return cachedGeometry;
+   }
+   
+   void Mesh::invalidateGeometry( void )
+   {
+      geometryIsValid = false;
+   }
+
+   const MeshAdjacency& Mesh::adjacency( void ) const
+   {
+      if( !adjacencyIsValid )
+      {
+         cachedAdjacency.build( *this );
+         adjacencyIsValid = true;
+      }
+      return cachedAdjacency;
+   }
+
+   void Mesh::invalidateConnectivity( void )
+   {
+      adjacencyIsValid = false;
+      invalidateGeometry();
+   }
+
+   void Mesh::reorder( MeshOrdering::Strategy strategy )
+   {
+      MeshOrdering ordering;
+      ordering.build( *this, strategy );
+      ordering.apply( *this );
+      indexElements();
+      invalidateGeometry();
+   }
 }
 
@@ -427,6 +427,8 @@ namespace DDG
    
    void Viewer :: drawPolygons( void )
    {
+      const MeshGeometry& geometry( mesh.geometry() );
+
       glEnable(GL_COLOR_MATERIAL);
       for( FaceCIter f  = mesh.faces.begin();
           f != mesh.faces.end();
@@ -437,7 +439,7 @@ namespace DDG
          glBegin( GL_POLYGON );
          if( renderWireframe )
          {
-            Vector N = f->normal();
+            Vector N = geometry.normal( f );
             glNormal3dv( &N[0] );
          }
          
@@ -446,7 +448,7 @@ namespace DDG
          {
             if( not renderWireframe )
             {
-               Vector N = he->vertex->normal();
+               Vector N = geometry.normal( he->vertex );
                glNormal3dv( &N[0] );
             }
             
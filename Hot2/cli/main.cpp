@@ -0,0 +1,95 @@
+// Headless driver: optimizes the vertex weights of the orthogonal dual and
+// writes them without opening a window (nothing here depends on OpenGL).
+// With --iterations=n it runs the full HOT loop, which also moves vertices
+// and flips edges, and writes the optimized mesh; --dual writes the power
+// diagram as a polygon mesh, and --areas and --lengths its cell areas and
+// dual edge lengths (the diagonal Hodge stars).  Build with "make cli".
+
+#include <iostream>
+#include <vector>
+using namespace std;
+
+#include "CommandLine.h"
+#include "Mesh.h"
+#include "Telemetry.h"
+#include "Application.h"
+#include "WeightedDelaunay.h"
+#include "DualMesh.h"
+using namespace DDG;
+
+namespace DDG
+{
+   extern Telemetry telemetry;
+}
+
+int main( int argc, char** argv )
+{
+   CommandLine args( argc, argv );
+   if( args.nPositional() != 1 )
+   {
+      cerr << "usage: " << args.program() << " in.obj"
+           << " [--delaunay] [--iterations=n] [--tolerance=1e-4] [--step=0.5]"
+           << " [--weights=weights.txt] [--out=out.obj]"
+           << " [--dual=dual.obj] [--areas=areas.txt] [--lengths=lengths.txt]"
+           << " [--quiet] [--telemetry=stats.json]" << endl;
+      return 1;
+   }
+   telemetry.setQuiet( args.has( "quiet" ));
+
+   Mesh mesh;
+   Timer timer;
+   if( mesh.read( args.positional( 0 ))) return 1;
+   telemetry.record( "cli.load", timer.elapsed() );
+   telemetry.print( "cli", "load", timer.elapsed(), "s" );
+
+   // extrinsic (embedded) Delaunay flips first, so that the cotan
+   // Laplacian has non-negative weights
+   if( args.has( "delaunay" ))
+   {
+      timer.start();
+      WeightedDelaunay delaunay;
+      delaunay.useWeights = false;
+      telemetry.record( "cli.delaunay.before", delaunay.countViolations( mesh ));
+      telemetry.record( "cli.delaunay.flips", delaunay.flip( mesh ));
+      telemetry.record( "cli.delaunay.after", delaunay.countViolations( mesh ));
+      telemetry.record( "cli.delaunay", timer.elapsed() );
+      telemetry.print( "cli", "delaunay", timer.elapsed(), "s" );
+   }
+
+   timer.start();
+   Application app;
+   if( args.has( "iterations" ))
+   {
+      app.optimize( mesh, args.value( "iterations", 20 ),
+                          args.value( "tolerance", 1e-4 ),
+                          args.value( "step", 0.5 ));
+   }
+   else
+   {
+      app.optimizeWeights( mesh );
+   }
+   telemetry.record( "cli.run", timer.elapsed() );
+   telemetry.print( "cli", "run", timer.elapsed(), "s" );
+
+   timer.start();
+   vector<double> weights;
+   weights.reserve( mesh.vertices.size() );
+   for( VertexCIter v = mesh.vertices.begin(); v != mesh.vertices.end(); v++ )
+   {
+      weights.push_back( v->weight );
+   }
+   if( CommandLine::writeValues( args.value( "weights", "weights.txt" ), weights )) return 1;
+   if( mesh.write( args.value( "out", "out.obj" ))) return 1;
+   if( args.has( "dual" ) or args.has( "areas" ) or args.has( "lengths" ))
+   {
+      DualMesh dual;
+      dual.build( mesh );
+      if( args.has( "dual" ) and dual.write( args.value( "dual", "dual.obj" ))) return 1;
+      if( args.has( "areas" ) and CommandLine::writeValues( args.value( "areas", "areas.txt" ), dual.areas )) return 1;
+      if( args.has( "lengths" ) and CommandLine::writeValues( args.value( "lengths", "lengths.txt" ), dual.lengths )) return 1;
+   }
+   telemetry.record( "cli.write", timer.elapsed() );
+   telemetry.print( "cli", "write", timer.elapsed(), "s" );
+
+   return args.writeTelemetry();
+}
@@ -7,24 +7,74 @@
 #ifndef DDG_APPLICATION_H
 #define DDG_APPLICATION_H
 
+#include <cmath>
+#include <iostream>
+#include <vector>
 #include "Mesh.h"
 #include "DenseMatrix.h"
 #include "SparseMatrix.h"
 #include "DiscreteExteriorCalculus.h"
+#include "Parallel.h"
+#include "Telemetry.h"
+#include "WeightedDelaunay.h"
 
 namespace DDG
 {
+   extern Telemetry telemetry;
+
    class Application
    {
    public:
+      int optimize(Mesh& mesh, int maxIterations, double tolerance = 1e-4, double step = 0.5)
+      // Hodge-optimized triangulation: alternates weight solves, weighted
+      // Delaunay edge flips and position updates until the energy (see
+      // energy()) changes by less than tolerance (relative) without any
+      // flips, or maxIterations is reached; returns the number of
+      // iterations.  The Laplacian is refactored numerically while the
+      // connectivity stays the same and analyzed anew after flips
+      {
+         bool connectivityChanged = true;
+         double lastEnergy = 0.0;
+         int totalFlips = 0;
+         int iteration = 0;
+         while( iteration < maxIterations )
+         {
+            iteration++;
+            solveWeights(mesh, connectivityChanged);
+
+            WeightedDelaunay delaunay;
+            int flips = delaunay.flip(mesh);
+            connectivityChanged = flips > 0;
+            totalFlips += flips;
+
+            std::vector<Vector> dual;
+            dualPoints(mesh, dual);
+            double E = energy(mesh, dual);
+            if( !telemetry.quiet() )
+            {
+               std::cout << "[hot] iteration " << iteration
+                         << ": energy = " << E
+                         << ", flips = " << flips << std::endl;
+            }
+
+            bool converged = iteration > 1 and flips == 0 and
+                             std::abs( lastEnergy - E ) <= tolerance * lastEnergy;
+            lastEnergy = E;
+            if( converged or iteration == maxIterations ) break;
+
+            updatePositions(mesh, dual, step);
+         }
+
+         telemetry.record( "hot.iterations", iteration );
+         telemetry.record( "hot.flips", totalFlips );
+         telemetry.record( "hot.energy", lastEnergy );
+         return iteration;
+      }
+
       void optimizeWeights(Mesh& mesh)
       {
-         SparseMatrix<Real> d0, star0, star1, Delta;
-         HodgeStar1Form<Real>::build( mesh, star1 );
-         HodgeStar0Form<Real>::build( mesh, star0 );
-         ExteriorDerivative0Form<Real>::build( mesh, d0 );
-         Delta = d0.transpose() * star1 * d0;
-         Delta += Real(1e-8)*star0;
+         SparseMatrix<Real> Delta;
+         buildLaplacian(mesh, Delta);
 
          DenseMatrix<Real> rhs;
          buildRhs(mesh, rhs);
@@ -35,30 +85,134 @@ namespace DDG
          assignSolution(mesh, x);
       }
       
+      double energy(const Mesh& mesh, const std::vector<Vector>& dual) const
+      // returns the sum over all faces of the area times the squared
+      // distance between the dual point and the barycenter
+      {
+         const MeshGeometry& geometry( mesh.geometry() );
+         double E = 0.0;
+         for( FaceCIter f = mesh.faces.begin(); f != mesh.faces.end(); f++ )
+         {
+            Vector r = dual[ f->index ] - f->barycenter();
+            E += geometry.faceAreas[ f->index ] * dot( r, r );
+         }
+         return E;
+      }
+
    protected:
-      void buildRhs(const Mesh& mesh, DenseMatrix<Real>& rhs) const
+      SparseFactor<Real> L;
+      // factorization of the Laplacian, reused by solveWeights()
+
+      void solveWeights(Mesh& mesh, bool connectivityChanged)
+      // same system as optimizeWeights()
       {
-         rhs = DenseMatrix<Real>(mesh.vertices.size(),1);
-         for( VertexCIter v = mesh.vertices.begin();
-             v != mesh.vertices.end();
-             v ++)
+         SparseMatrix<Real> Delta;
+         buildLaplacian(mesh, Delta);
+
+         if( connectivityChanged or !L.valid() or !L.refactor( Delta ))
          {
-            double sum = 0.0;
-            HalfEdgeIter he = v->he;
-            do
+            L.build( Delta );
+         }
+
+         DenseMatrix<Real> rhs;
+         buildRhs(mesh, rhs);
+
+         DenseMatrix<Real> x;
+         backsolvePositiveDefinite(L, x, rhs);
+
+         assignSolution(mesh, x);
+      }
+
+      void dualPoints(const Mesh& mesh, std::vector<Vector>& dual) const
+      {
+         dual.resize( mesh.faces.size() );
+         parallelFor( 0, mesh.faces.size(), [&]( int begin, int end )
+         {
+            for( int i = begin; i < end; i++ )
+            {
+               dual[i] = mesh.faces[i].dualPoint();
+            }
+         });
+      }
+
+      void updatePositions(Mesh& mesh, const std::vector<Vector>& dual, double step) const
+      // moves each interior vertex by step times the tangential part of the
+      // offset to the area-weighted average of the dual points of its
+      // triangles; boundary vertices stay in place
+      {
+         const MeshGeometry& geometry( mesh.geometry() );
+         const MeshAdjacency& adjacency( mesh.adjacency() );
+         std::vector<Vector> target( mesh.vertices.size() );
+         forEachVertexOneRing( adjacency, [&]( int i, int begin, int end )
+         {
+            Vector p = mesh.vertices[i].position;
+            Vector sum;
+            double A = 0.0;
+            for( int k = begin; k < end; k++ )
             {
-               if( !he->onBoundary )
+               int f = adjacency.face[k];
+               if( f < 0 )
                {
-                  Vector n = he->next->rotatedEdge();
-                  Vector c = he->face->circumcenter();
-                  Vector b = he->face->barycenter();
-                  sum += dot( n, c-b );
+                  target[i] = p;
+                  return;
                }
-               he = he->flip->next;
+               sum += geometry.faceAreas[f] * dual[f];
+               A += geometry.faceAreas[f];
+            }
+            if( A <= 0.0 )
+            {
+               target[i] = p;
+               return;
             }
-            while( he != v->he );
-            rhs(v->index,0) = sum;
+
+            Vector offset = sum/A - p;
+            const Vector& n( geometry.vertexNormals[i] );
+            offset -= dot( offset, n ) * n;
+            target[i] = p + step*offset;
+         });
+
+         for( VertexIter v = mesh.vertices.begin(); v != mesh.vertices.end(); v++ )
+         {
+            v->position = target[ v->index ];
          }
+         mesh.invalidateGeometry();
+      }
+
+      void buildLaplacian(const Mesh& mesh, SparseMatrix<Real>& Delta) const
+      // cotan Laplacian, shifted by a small multiple of the mass matrix to
+      // make it positive definite
+      {
+         SparseMatrix<Real> d0, star0, star1;
+         HodgeStar1Form<Real>::build( mesh, star1 );
+         HodgeStar0Form<Real>::build( mesh, star0 );
+         ExteriorDerivative0Form<Real>::build( mesh, d0 );
+         Delta = d0.transpose() * star1 * d0;
+         Delta += Real(1e-8)*star0;
+      }
+
+      void buildRhs(const Mesh& mesh, DenseMatrix<Real>& rhs) const
+      {
+         rhs = DenseMatrix<Real>(mesh.vertices.size(),1);
+         const MeshGeometry& geometry( mesh.geometry() );
+         const MeshAdjacency& adjacency( mesh.adjacency() );
+         forEachVertexOneRing( adjacency, [&]( int i, int begin, int end )
+         {
+            double sum = 0.0;
+            for( int k = begin; k < end; k++ )
+            {
+               int f = adjacency.face[k];
+               if( f < 0 ) continue;
+
+               // he->next rotated by PI/2 around the face normal
+               const HalfEdge& e( mesh.halfedges[ adjacency.next[k] ] );
+               Vector n = cross( geometry.faceNormals[f],
+                                 e.flip->vertex->position - e.vertex->position );
+               Vector c = geometry.circumcenters[f];
+               Vector b = mesh.faces[f].barycenter();
+               sum += dot( n, c-b );
+            }
+            rhs(i,0) = sum;
+         });
       }
       
       void assignSolution(Mesh& mesh, const DenseMatrix<Real>& x) const
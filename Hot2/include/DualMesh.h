@@ -0,0 +1,233 @@
+#ifndef DDG_DUAL_MESH_H
+#define DDG_DUAL_MESH_H
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Mesh.h"
+#include "MeshAdjacency.h"
+#include "MeshGeometry.h"
+#include "Parallel.h"
+
+namespace DDG
+{
+   class DualMesh
+   // The orthogonal dual (power diagram) of a weighted triangulation, as
+   // data: one dual point per triangle (Face::dualPoint()), one dual edge
+   // per primal edge and one cell polygon per vertex.  Cells of interior
+   // vertices connect the dual points of the incident triangles; cells of
+   // boundary vertices are closed by the dual points of the two boundary
+   // edges (Edge::dualPoint()) and the vertex itself.  Cells are oriented
+   // like the primal triangles.  All quantities are computed in parallel
+   // from the cached geometry and adjacency, e.g.,
+   //
+   //    DualMesh dual;
+   //    dual.build( mesh );
+   //    dual.write( "dual.obj" );
+   //    // dual.areas[i]         -- diagonal entry i of star0
+   //    // dual.lengths[e] / l_e -- diagonal entry e of star1
+   //
+   {
+   public:
+      void build(const Mesh& mesh)
+      {
+         const MeshGeometry& geometry( mesh.geometry() );
+         const MeshAdjacency& adjacency( mesh.adjacency() );
+         int nV = mesh.vertices.size();
+         int nE = mesh.edges.size();
+         int nF = mesh.faces.size();
+
+         // boundary edges and vertices get points of their own, stored
+         // after the dual points of the faces
+         edgePoint.assign( nE, -1 );
+         vertexPoint.assign( nV, -1 );
+         int nPoints = nF;
+         for( EdgeCIter e = mesh.edges.begin(); e != mesh.edges.end(); e++ )
+         {
+            if( e->he->onBoundary or e->he->flip->onBoundary )
+            {
+               edgePoint[ e->index ] = nPoints++;
+            }
+         }
+         for( int i = 0; i < nV; i++ )
+         {
+            for( int k = adjacency.offsets[i]; k < adjacency.offsets[i+1]; k++ )
+            {
+               if( adjacency.face[k] < 0 )
+               {
+                  vertexPoint[i] = nPoints++;
+                  break;
+               }
+            }
+         }
+         points.resize( nPoints );
+         for( int i = 0; i < nV; i++ )
+         {
+            if( vertexPoint[i] >= 0 ) points[ vertexPoint[i] ] = mesh.vertices[i].position;
+         }
+
+         // dual points and edges
+         parallelFor( 0, nF, [&]( int begin, int end )
+         {
+            for( int i = begin; i < end; i++ )
+            {
+               HalfEdgeCIter h = mesh.faces[i].he;
+               Vector p0 = h->vertex->position;
+               Vector p1 = h->flip->vertex->position;
+               Vector n = cross( geometry.faceNormals[i], p1-p0 ).unit();
+               points[i] = edgeDualPoint( h->edge ) + height( geometry, h )*n;
+            }
+         });
+
+         lengths.resize( nE );
+         parallelFor( 0, nE, [&]( int begin, int end )
+         {
+            for( int i = begin; i < end; i++ )
+            {
+               HalfEdgeCIter h = mesh.edges[i].he;
+               lengths[i] = height( geometry, h ) + height( geometry, h->flip );
+               if( edgePoint[i] >= 0 ) points[ edgePoint[i] ] = edgeDualPoint( h->edge );
+            }
+         });
+
+         // cells, listed in reverse circulation order (the one-ring runs
+         // clockwise around the primal normal)
+         offsets.assign( nV+1, 0 );
+         for( int i = 0; i < nV; i++ )
+         {
+            int n = adjacency.valence(i);
+            offsets[i+1] = offsets[i] + ( vertexPoint[i] < 0 ? n : n+2 );
+         }
+         cells.resize( offsets[nV] );
+         areas.resize( nV );
+         forEachVertexOneRing( adjacency, [&]( int i, int begin, int end )
+         {
+            int* cell = &cells[0] + offsets[i];
+            int n = end - begin;
+            if( vertexPoint[i] < 0 )
+            {
+               for( int k = 0; k < n; k++ )
+               {
+                  cell[k] = adjacency.face[ end-1-k ];
+               }
+            }
+            else
+            {
+               // start on the halfedge that runs along the boundary loop
+               int b = begin;
+               while( adjacency.face[b] >= 0 ) b++;
+
+               // clockwise: vertex, boundary edge of b, faces, boundary
+               // edge of the halfedge before b; then reversed
+               int m = 0;
+               cell[m++] = vertexPoint[i];
+               cell[m++] = edgePoint[ mesh.halfedges[ adjacency.halfedge[b] ].edge->index ];
+               for( int j = 1; j < n; j++ )
+               {
+                  int k = begin + (b-begin+j) % n;
+                  cell[m++] = adjacency.face[k];
+               }
+               int last = begin + (b-begin+n-1) % n;
+               cell[m++] = edgePoint[ mesh.halfedges[ adjacency.halfedge[last] ].edge->index ];
+               for( int j = 0; j < m/2; j++ ) std::swap( cell[j], cell[m-1-j] );
+               n = m;
+            }
+
+            // signed area w.r.t. the vertex normal
+            Vector p = mesh.vertices[i].position;
+            Vector sum;
+            for( int k = 0; k < n; k++ )
+            {
+               sum += cross( points[ cell[k] ] - p, points[ cell[(k+1)%n] ] - p );
+            }
+            areas[i] = 0.5 * dot( sum, geometry.vertexNormals[i] );
+         });
+      }
+
+      int write(const std::string& filename) const
+      // writes the dual points and cells as a Wavefront OBJ file; return
+      // value is nonzero only if there was an error
+      {
+         std::ofstream out( filename.c_str() );
+         if( !out.is_open() )
+         {
+            std::cerr << "Error: couldn't open file " << filename << " for output." << std::endl;
+            return 1;
+         }
+
+         for( size_t i = 0; i < points.size(); i++ )
+         {
+            out << "v " << points[i].x << " " << points[i].y << " " << points[i].z << "\n";
+         }
+
+         for( size_t i = 0; i+1 < offsets.size(); i++ )
+         {
+            if( offsets[i+1] - offsets[i] < 3 ) continue;
+            out << "f";
+            for( int k = offsets[i]; k < offsets[i+1]; k++ )
+            {
+               out << " " << cells[k]+1;
+            }
+            out << "\n";
+         }
+
+         if( out.fail() )
+         {
+            std::cerr << "Error writing to file " << filename << std::endl;
+            return 1;
+         }
+         return 0;
+      }
+
+      std::vector<Vector> points;
+      // dual point of face f at index f->index, followed by the dual
+      // points of boundary edges and the positions of boundary vertices
+
+      std::vector<int> offsets;
+      std::vector<int> cells;
+      // the cell of vertex i lists the indices of its corners in points as
+      // entries offsets[i], ..., offsets[i+1]-1
+
+      std::vector<double> lengths;
+      // signed length of the dual edge per edge index (negative if the
+      // edge is not locally regular)
+
+      std::vector<double> areas;
+      // signed area of the cell per vertex index
+
+   protected:
+      std::vector<int> edgePoint;
+      std::vector<int> vertexPoint;
+      // index in points of boundary edges and vertices, or -1
+
+      static Vector edgeDualPoint(EdgeCIter e)
+      // same as Edge::dualPoint()
+      {
+         Vector pi = e->he->vertex->position;
+         Vector pj = e->he->flip->vertex->position;
+         return pi + e->he->shift() * (pj - pi).unit();
+      }
+
+      static double height(const MeshGeometry& geometry, HalfEdgeCIter h)
+      // same as HalfEdge::height(), with cached cotangents
+      {
+         if( h->onBoundary ) return 0.0;
+
+         double cotk = geometry.cotan( h );
+         double coti = geometry.cotan( h->next );
+         double cotj = geometry.cotan( h->next->next );
+
+         double wk = h->next->next->vertex->weight;
+         double wi = h->vertex->weight;
+         double wj = h->next->vertex->weight;
+
+         double lij = geometry.length( h->edge );
+
+         return 0.5*(lij*cotk + (wi-wk)*cotj/lij + (wj-wk)*coti/lij);
+      }
+   };
+}
+
+#endif
@@ -0,0 +1,124 @@
+#ifndef DDG_WEIGHTED_DELAUNAY_H
+#define DDG_WEIGHTED_DELAUNAY_H
+
+#include <queue>
+#include <utility>
+#include <vector>
+#include "Mesh.h"
+
+namespace DDG
+{
+   class WeightedDelaunay
+   // Restores the (weighted) Delaunay property by edge flips.  An interior
+   // edge is locally regular if its dual edge -- the segment between the
+   // dual points of its two triangles -- has non-negative signed length
+   // h->height() + h->flip->height().  With all weights zero this is the
+   // usual Delaunay condition cot(alpha) + cot(beta) >= 0, so the cotan
+   // Laplacian of the result has non-negative edge weights.  Edges are
+   // processed most violated first from a priority queue; after each flip
+   // only the four edges of the surrounding quadrilateral are re-examined.
+   // Flips operate on the embedded mesh and never create inverted
+   // triangles, so on curved surfaces a few violations may remain.
+   {
+   public:
+      WeightedDelaunay( void ) : useWeights( true ) {}
+
+      bool useWeights;
+      // if false, vertex weights are ignored (plain Delaunay)
+
+      int flip(Mesh& mesh)
+      // flips until all edges are locally regular or no violated edge can
+      // be flipped; returns the number of flips
+      {
+         stamp.assign( mesh.edges.size(), 0 );
+         Queue Q;
+         for( EdgeIter e = mesh.edges.begin(); e != mesh.edges.end(); e++ )
+         {
+            push( Q, e );
+         }
+
+         // each flip strictly improves the configuration in the plane, but
+         // weights or curvature can lead to cycles -- hence the budget
+         int nFlips = 0;
+         int budget = 10 * mesh.edges.size();
+         while( !Q.empty() and nFlips < budget )
+         {
+            Entry top = Q.top();
+            Q.pop();
+
+            EdgeIter e = mesh.edges.begin() + top.second.first;
+            if( top.second.second != stamp[ e->index ] ) continue; // stale
+            if( violation( e ) >= 0.0 ) continue;
+            if( !canFlip( e->he )) continue;
+            if( !mesh.flip( e )) continue;
+            nFlips++;
+
+            stamp[ e->index ]++;
+            HalfEdgeIter h = e->he;
+            HalfEdgeIter t = h->flip;
+            push( Q, h->next->edge );
+            push( Q, h->next->next->edge );
+            push( Q, t->next->edge );
+            push( Q, t->next->next->edge );
+         }
+         return nFlips;
+      }
+
+      int countViolations(const Mesh& mesh) const
+      // returns the number of interior edges that are not locally regular
+      {
+         int n = 0;
+         for( EdgeCIter e = mesh.edges.begin(); e != mesh.edges.end(); e++ )
+         {
+            if( violation( e ) < 0.0 ) n++;
+         }
+         return n;
+      }
+
+      static bool canFlip(HalfEdgeCIter h)
+      // returns true if both triangles created by flipping h face the
+      // same way as the two it replaces
+      {
+         Vector a = h->vertex->position;
+         Vector b = h->flip->vertex->position;
+         Vector c = h->next->next->vertex->position;
+         Vector d = h->flip->next->next->vertex->position;
+         Vector n = cross( b-a, c-a ) + cross( a-b, d-b );
+         return dot( cross( c-d, a-d ), n ) > 0.0 and
+                dot( cross( d-c, b-c ), n ) > 0.0;
+      }
+
+   protected:
+      typedef std::pair< double, std::pair<int,int> > Entry;
+      typedef std::priority_queue< Entry, std::vector<Entry>, std::greater<Entry> > Queue;
+      // (violation, (edge index, stamp)), most negative violation on top
+
+      std::vector<int> stamp;
+      // per edge, incremented whenever the edge is flipped so that queue
+      // entries computed before the flip are recognized as stale
+
+      double violation(EdgeCIter e) const
+      // returns the signed length of the dual edge relative to the primal
+      // edge length (zero on the boundary); negative if e is not locally
+      // regular
+      {
+         HalfEdgeCIter h = e->he;
+         if( h->onBoundary or h->flip->onBoundary ) return 0.0;
+
+         double l = ( h->flip->vertex->position - h->vertex->position ).norm();
+         if( useWeights )
+         {
+            return ( h->height() + h->flip->height() ) / l;
+         }
+         return 0.5 * ( h->cotan() + h->flip->cotan() );
+      }
+
+      void push(Queue& Q, EdgeCIter e) const
+      {
+         double v = violation( e );
+         if( v < 0.0 ) Q.push( Entry( v, std::make_pair( e->index, stamp[ e->index ] )));
+      }
+   };
+}
+
+#endif
@@ -9,9 +9,13 @@ using namespace std;
 namespace DDG
 {
    Mesh :: Mesh( void )
+   : geometryIsValid( false ),
+     adjacencyIsValid( false )
    {}
    
    Mesh :: Mesh( const Mesh& mesh )
+   : geometryIsValid( false ),
+     adjacencyIsValid( false )
    {
       *this = mesh;
    }
@@ -65,6 +69,8 @@ namespace DDG
       for(   EdgeIter e =    edges.begin(); e !=    edges.end(); e++ ) e->he = halfedgeOldToNew[ e->he ];
       for(   FaceIter f =    faces.begin(); f !=    faces.end(); f++ ) f->he = halfedgeOldToNew[ f->he ];
       
+      invalidateConnectivity();
+      
       return *this;
    }
    
@@ -79,6 +85,8 @@ namespace DDG
          return 1;
       }
       
+      invalidateGeometry();
+      
       int rval;
       if( !( rval = MeshIO::read( in, *this )))
       {
@@ -136,6 +144,8 @@ namespace DDG
       {
          v->position /= rMax;
       }
+      
+      invalidateGeometry();
    }
    
    void Mesh::indexElements( void )
@@ -160,6 +170,8 @@ namespace DDG
          f->index = nF;
          nF++;
       }
+
+      adjacencyIsValid = false;
    }
    
    double Mesh::area( void ) const
@@ -187,5 +199,82 @@ namespace DDG
       }
       return sum / edges.size();
    }
+   
+   const MeshGeometry& Mesh::geometry( void ) const
+   {
+      if( !geometryIsValid )
+      {
+         cachedGeometry.build( *this );
+         geometryIsValid = true;
+      }
+      return cachedGeometry;
+   }
+   
+   void Mesh::invalidateGeometry( void )
+   {
+      geometryIsValid = false;
+   }
+
+   const MeshAdjacency& Mesh::adjacency( void ) const
+   {
+      if( !adjacencyIsValid )
+      {
+         cachedAdjacency.build( *this );
+         adjacencyIsValid = true;
+      }
+      return cachedAdjacency;
+   }
+
+   void Mesh::invalidateConnectivity( void )
+   {
+      adjacencyIsValid = false;
+      invalidateGeometry();
+   }
+
+   void Mesh::reorder( MeshOrdering::Strategy strategy )
+   {
+      MeshOrdering ordering;
+      ordering.build( *this, strategy );
+      ordering.apply( *this );
+      indexElements();
+      invalidateGeometry();
+   }
+
+   bool Mesh::flip( EdgeIter e )
+   {
+      // before, h runs from a to b in triangle (a,b,c) and its flip t
+      // from b to a in triangle (b,a,d); afterwards h runs from d to c in
+      // triangle (d,c,a) and t from c to d in triangle (c,d,b)
+      HalfEdgeIter h = e->he;
+      HalfEdgeIter t = h->flip;
+      if( h->onBoundary or t->onBoundary ) return false;
+
+      HalfEdgeIter h1 = h->next, h2 = h1->next;
+      HalfEdgeIter t1 = t->next, t2 = t1->next;
+      VertexIter a = h->vertex, b = t->vertex;
+      VertexIter c = h2->vertex, d = t2->vertex;
+      FaceIter f = h->face, g = t->face;
+
+      // the new diagonal must not already exist
+      if( c == d ) return false;
+      HalfEdgeIter k = c->he;
+      do
+      {
+         if( k->flip->vertex == d ) return false;
+         k = k->flip->next;
+      }
+      while( k != c->he );
+
+      if( a->he == h ) a->he = t1;
+      if( b->he == t ) b->he = h1;
+
+      h->vertex = d; h->next = h2; h2->next = t1; t1->next = h;
+      t->vertex = c; t->next = t2; t2->next = h1; h1->next = t;
+      t1->face = f; h1->face = g;
+      f->he = h; g->he = t;
+
+      invalidateConnectivity();
+      return true;
+   }
 }
 
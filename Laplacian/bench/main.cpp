@@ -0,0 +1,100 @@
+// Benchmark driver: times the core stages of libDDG and curvature flow and the
+// Poisson solve on synthetic meshes (see Benchmark.h for options).  Build with
+// "make bench".
+//
+// With --backends (or --backends=eigen-llt,cholmod-supernodal,...) the Poisson
+// problem and one curvature flow step are also solved with every listed sparse
+// solver backend (all by default; see SparseSolver.h), recording the stages
+// "<backend>.factor", "<backend>.solve", "<backend>.flow-factor" and
+// "<backend>.flow-solve" and the size of the Poisson factor in megabytes as
+// "bench.<case>.<backend>.memory".
+
+#include <iostream>
+#include <string>
+#include <vector>
+using namespace std;
+
+#include "CommandLine.h"
+#include "Benchmark.h"
+#include "Mesh.h"
+#include "Telemetry.h"
+#include "Laplacian.h"
+using namespace DDG;
+
+namespace DDG
+{
+   extern Telemetry telemetry;
+}
+
+int main( int argc, char** argv )
+{
+   CommandLine args( argc, argv );
+   Benchmark bench( args );
+
+   vector<SparseSolver::Backend> backends;
+   if( args.has( "backends" ))
+   {
+      vector<string> names = args.list( "backends" );
+      for( int b = 0; names.empty() and b < SparseSolver::nBackends; b++ )
+      {
+         backends.push_back( SparseSolver::Backend( b ));
+      }
+      for( size_t k = 0; k < names.size(); k++ )
+      {
+         SparseSolver::Backend backend;
+         if( SparseSolver::parse( names[k], backend ))
+         {
+            cerr << "Error: unknown solver " << names[k] << endl;
+            return 1;
+         }
+         backends.push_back( backend );
+      }
+   }
+
+   for( int i = 0; i < bench.nCases(); i++ )
+   {
+      Mesh mesh;
+      if( bench.load( i, mesh )) return 1;
+      bench.runCore( i, mesh );
+
+      for( int r = 0; r < bench.repeat(); r++ )
+      {
+         if( mesh.reload() ) return 1;
+         randomAssignRho( mesh );
+
+         Timer timer;
+         Laplacian Lap;
+         Lap.buildLaplacian( mesh );
+         Lap.solveScalarPoissonProblem( mesh );
+         bench.record( i, "poisson", timer.elapsed() );
+
+         timer.start();
+         Lap.soomthMesh( mesh, 0.001 );
+         bench.record( i, "app", timer.elapsed() );
+
+         // same problems with each backend
+         for( size_t b = 0; b < backends.size(); b++ )
+         {
+            string name = SparseSolver::name( backends[b] );
+            if( mesh.reload() ) return 1;
+            randomAssignRho( mesh );
+
+            Laplacian Lap;
+            Lap.setBackend( backends[b] );
+            Lap.buildLaplacian( mesh );
+            Lap.solveScalarPoissonProblem( mesh );
+            const SparseSolver& poisson( Lap.poissonSolver() );
+            bench.record( i, name + ".factor", poisson.factorTime );
+            bench.record( i, name + ".solve", poisson.solveTime );
+            telemetry.record( "bench." + bench.name( i ) + "." + name + ".memory", poisson.memory() / 1e6 );
+
+            Lap.soomthMesh( mesh, 0.001 );
+            const SparseSolver& flow( Lap.smoothingSolver() );
+            bench.record( i, name + ".flow-factor", flow.factorTime );
+            bench.record( i, name + ".flow-solve", flow.solveTime );
+         }
+      }
+   }
+
+   return bench.finish();
+}
@@ -0,0 +1,89 @@
+// Headless driver: either smooths a mesh by curvature flow or solves a scalar
+// Poisson problem for a random density, and writes the result without opening
+// a window (nothing here depends on OpenGL).  Build with "make cli".
+
+#include <iostream>
+#include <vector>
+using namespace std;
+
+#include "CommandLine.h"
+#include "Mesh.h"
+#include "Telemetry.h"
+#include "Laplacian.h"
+using namespace DDG;
+
+namespace DDG
+{
+   extern Telemetry telemetry;
+}
+
+int main( int argc, char** argv )
+{
+   CommandLine args( argc, argv );
+   if( args.nPositional() != 1 )
+   {
+      cerr << "usage: " << args.program() << " in.obj"
+           << " [--step=0.001] [--steps=1] [--out=out.obj]"
+           << " [--poisson [--phi=phi.txt]]"
+           << " [--solver=eigen-lu|eigen-llt|cholmod-simplicial|cholmod-supernodal|cholmod-auto]"
+           << " [--quiet] [--telemetry=stats.json]" << endl;
+      return 1;
+   }
+   telemetry.setQuiet( args.has( "quiet" ));
+
+   SparseSolver::Backend backend = SparseSolver::cholmodSimplicial;
+   if( args.has( "solver" ) and SparseSolver::parse( args.value( "solver", "" ), backend ))
+   {
+      cerr << "Error: unknown solver " << args.value( "solver", "" ) << endl;
+      return 1;
+   }
+
+   Mesh mesh;
+   Timer timer;
+   if( mesh.read( args.positional( 0 ))) return 1;
+   telemetry.record( "cli.load", timer.elapsed() );
+   telemetry.print( "cli", "load", timer.elapsed(), "s" );
+
+   Laplacian Lap;
+   Lap.setBackend( backend );
+
+   if( args.has( "poisson" ))
+   {
+      timer.start();
+      randomAssignRho( mesh );
+      Lap.buildLaplacian( mesh );
+      Lap.solveScalarPoissonProblem( mesh );
+      telemetry.record( "cli.run", timer.elapsed() );
+      telemetry.print( "cli", "run", timer.elapsed(), "s" );
+
+      timer.start();
+      vector<double> phi;
+      phi.reserve( mesh.vertices.size() );
+      for( VertexCIter v = mesh.vertices.begin(); v != mesh.vertices.end(); v++ )
+      {
+         phi.push_back( v->phi );
+      }
+      if( CommandLine::writeValues( args.value( "phi", "phi.txt" ), phi )) return 1;
+      telemetry.record( "cli.write", timer.elapsed() );
+      telemetry.print( "cli", "write", timer.elapsed(), "s" );
+
+      return args.writeTelemetry();
+   }
+
+   timer.start();
+   double step = args.value( "step", 0.001 );
+   int nSteps = args.value( "steps", 1 );
+   for( int i = 0; i < nSteps; i++ )
+   {
+      Lap.soomthMesh( mesh, step );
+   }
+   telemetry.record( "cli.run", timer.elapsed() );
+   telemetry.print( "cli", "run", timer.elapsed(), "s" );
+
+   timer.start();
+   if( mesh.write( args.value( "out", "out.obj" ))) return 1;
+   telemetry.record( "cli.write", timer.elapsed() );
+   telemetry.print( "cli", "write", timer.elapsed(), "s" );
+
+   return args.writeTelemetry();
+}
@@ -6,8 +6,7 @@
 
 #include <Eigen/Sparse>
 
-#include <Eigen/Sparse>
-#include <Eigen/CholmodSupport>
+#include "SparseSolver.h"
 
 namespace DDG
 {
@@ -22,17 +21,7 @@ namespace DDG
     {
         typedef Eigen::SparseMatrix<double> spMat;
 
-        #define _CHOL_TYPE_ 3
-
-        #if _CHOL_TYPE_ == 1
-            typedef Eigen::SparseLU<spMat> cholSolver;
-        #elif _CHOL_TYPE_ == 2
-            typedef Eigen::SimplicialLLT<spMat> cholSolver;
-        #elif _CHOL_TYPE_ == 3
-            typedef Eigen::CholmodSimplicialLLT<spMat> cholSolver;
-        #elif _CHOL_TYPE_ == 4
-            typedef Eigen::CholmodSupernodalLLT<spMat> cholSolver;
-        #endif
+        public:
 
         /* build laplacian matrix of the mesh */
         void buildLaplacian( Mesh& mesh );
@@ -42,14 +31,30 @@ namespace DDG
 
         /* calculate a step forward to soomth mesh according to curvature flow */
         void soomthMesh(Mesh& mesh, double h);
+
+        /* select the sparse solver used for all systems (CHOLMOD simplicial
+         * by default); takes effect with the next factorization */
+        void setBackend( SparseSolver::Backend backend )
+        {
+            negLapSolver.setBackend( backend );
+            flowSolver.setBackend( backend );
+        }
+
+        /* solver of the Poisson problem and of the last curvature flow step,
+         * for timings and factor sizes */
+        const SparseSolver& poissonSolver( void ) const { return negLapSolver; }
+        const SparseSolver& smoothingSolver( void ) const { return flowSolver; }
       
         protected:
 
         spMat Laplacian;
         // Laplacian sprase matrix of the mesh
 
-        cholSolver negLapSolver;
-        // cholmode solver based on SuiteSparse
+        SparseSolver negLapSolver;
+        // factorization of -Laplacian
+
+        SparseSolver flowSolver;
+        // factorization of A - h*Laplacian from the last curvature flow step
     };
 
 }
@@ -49,6 +49,9 @@
 #include "Vertex.h"
 #include "Edge.h"
 #include "Face.h"
+#include "MeshAdjacency.h"
+#include "MeshGeometry.h"
+#include "MeshOrdering.h"
 #include "SparseMatrix.h"
 
 
@@ -86,6 +89,28 @@ namespace DDG
       double meanEdgeLength( void  ) const;
       // returns mean edge lenght
 
+      const MeshGeometry& geometry( void ) const;
+      // returns cached cotangents, areas, normals, etc., recomputing
+      // them first if the cache has been invalidated
+
+      void invalidateGeometry( void );
+      // marks the cached geometry as stale; must be called after
+      // changing vertex positions or connectivity
+
+      const MeshAdjacency& adjacency( void ) const;
+      // returns the one rings of all vertices in flat arrays (see
+      // MeshAdjacency.h), recollecting them first if the cache has
+      // been invalidated
+
+      void invalidateConnectivity( void );
+      // marks the cached adjacency and geometry as stale; must be
+      // called after editing connectivity
+
+      void reorder( MeshOrdering::Strategy strategy );
+      // permutes vertices, edges, faces and halfedges to improve memory
+      // locality (see MeshOrdering.h) and reassigns element indices;
+      // iterators stored in the mesh remain valid, all others do not
+
       std::vector<HalfEdge> halfedges;
       std::vector<Vertex>   vertices;
       std::vector<Edge>     edges;
@@ -95,6 +120,14 @@ namespace DDG
       
    protected:
       std::string inputFilename;
+
+      mutable MeshGeometry cachedGeometry;
+      mutable bool geometryIsValid;
+      // per-element quantities, computed on demand by geometry()
+
+      mutable MeshAdjacency cachedAdjacency;
+      mutable bool adjacencyIsValid;
+      // one rings, collected on demand by adjacency()
       
       void indexElements( void );
       // assigns a unique, 0-based index to each mesh element
@@ -0,0 +1,223 @@
+#ifndef DDG_SPARSE_SOLVER_H
+#define DDG_SPARSE_SOLVER_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <Eigen/Dense>
+#include <Eigen/Sparse>
+#include <Eigen/CholmodSupport>
+#include "DenseMatrix.h"
+#include "Real.h"
+#include "SparseMatrix.h"
+#include "Telemetry.h"
+
+namespace DDG
+{
+   class SparseSolver
+   // Direct solver for sparse linear systems whose backend is chosen at run
+   // time.  The Eigen backends need no external library; the CHOLMOD
+   // backends differ in the factorization variant only (simplicial LL^T,
+   // supernodal LL^T, or CHOLMOD's own choice based on flops/nnz(L), cf.
+   // LinearContext::Factorization).  Matrices and right-hand sides may be
+   // given either as Eigen or as DDG types, e.g.,
+   //
+   //    SparseSolver solver( SparseSolver::cholmodSupernodal );
+   //    if( !solver.compute( A )) return 1;  // Eigen::SparseMatrix or
+   //    solver.solve( b, x );                // SparseMatrix<Real>
+   //
+   // After each call the wall-clock time of the last factorization and
+   // solve and the number of nonzeros in the factor are available, which
+   // is what laplacian-bench --backends compares.
+   {
+   public:
+      typedef Eigen::SparseMatrix<double> spMat;
+
+      enum Backend
+      {
+         eigenLU,
+         eigenLLT,
+         cholmodSimplicial,
+         cholmodSupernodal,
+         cholmodAutomatic,
+         nBackends
+      };
+      // Eigen::SparseLU, Eigen::SimplicialLLT, and Eigen::CholmodDecomposition
+      // in the three CHOLMOD modes; all but eigenLU require A to be
+      // symmetric positive-definite (only the lower triangle is read)
+
+      SparseSolver( Backend backend = cholmodSimplicial )
+      : factorTime( 0. ), solveTime( 0. ), factorNonZeros( 0. ), currentBackend( backend )
+      {}
+
+      void setBackend(Backend backend)
+      // selects a backend; the next call to compute() uses it
+      {
+         clear();
+         currentBackend = backend;
+      }
+
+      Backend backend( void ) const
+      {
+         return currentBackend;
+      }
+
+      static const char* name(Backend backend)
+      // returns the command line name of backend
+      {
+         static const char* names[] = { "eigen-lu", "eigen-llt", "cholmod-simplicial",
+                                        "cholmod-supernodal", "cholmod-auto" };
+         return backend >= 0 and backend < nBackends ? names[ backend ] : "unknown";
+      }
+
+      static int parse(const std::string& s, Backend& backend)
+      // sets backend from its command line name; return value is nonzero
+      // only if there is no such backend
+      {
+         for( int b = 0; b < nBackends; b++ )
+         {
+            if( s == name( Backend( b )))
+            {
+               backend = Backend( b );
+               return 0;
+            }
+         }
+         return 1;
+      }
+
+      bool compute(const spMat& A)
+      // factorizes A; returns false if the factorization failed
+      {
+         clear();
+         Timer timer;
+         bool ok = false;
+         switch( currentBackend )
+         {
+            case eigenLU:
+               lu.reset( new Eigen::SparseLU<spMat>() );
+               if( A.isCompressed() ) lu->compute( A );
+               else lu->compute( spMat( A ));
+               ok = lu->info() == Eigen::Success;
+               if( ok ) factorNonZeros = lu->nnzL() + lu->nnzU();
+               break;
+            case eigenLLT:
+               llt.reset( new Eigen::SimplicialLLT<spMat>() );
+               llt->compute( A );
+               ok = llt->info() == Eigen::Success;
+               if( ok ) factorNonZeros = llt->matrixL().nestedExpression().nonZeros();
+               break;
+            default:
+               cholmod.reset( new Eigen::CholmodDecomposition<spMat>() );
+               cholmod->setMode( currentBackend == cholmodSimplicial ? Eigen::CholmodSimplicialLLt :
+                                 currentBackend == cholmodSupernodal ? Eigen::CholmodSupernodalLLt :
+                                                                       Eigen::CholmodAuto );
+               cholmod->compute( A );
+               ok = cholmod->info() == Eigen::Success;
+               if( ok ) factorNonZeros = cholmod->cholmod().lnz;
+               break;
+         }
+         factorTime = timer.elapsed();
+         if( !ok ) clear(); // so that solve() fails instead of using it
+         return ok;
+      }
+
+      bool compute(const SparseMatrix<Real>& A)
+      // factorizes A, given as a DDG matrix
+      {
+         std::vector< Eigen::Triplet<double> > entries;
+         for( SparseMatrix<Real>::const_iterator e = A.begin(); e != A.end(); e++ )
+         {
+            // entries are indexed by (column, row)
+            entries.push_back( Eigen::Triplet<double>( e->first.second, e->first.first, e->second ));
+         }
+         spMat B( A.nRows(), A.nColumns() );
+         B.setFromTriplets( entries.begin(), entries.end() );
+         return compute( B );
+      }
+
+      template <class Rhs, class Result>
+      bool solve(const Rhs& b, Result& x)
+      // solves Ax = b for one or more right-hand sides with the last
+      // factorization; returns false if no valid factorization exists
+      {
+         Timer timer;
+         bool ok = false;
+         if( lu )
+         {
+            x = lu->solve( b );
+            ok = lu->info() == Eigen::Success;
+         }
+         else if( llt )
+         {
+            x = llt->solve( b );
+            ok = llt->info() == Eigen::Success;
+         }
+         else if( cholmod )
+         {
+            x = cholmod->solve( b );
+            ok = cholmod->info() == Eigen::Success;
+         }
+         solveTime = timer.elapsed();
+         return ok;
+      }
+
+      bool solve(const DenseMatrix<Real>& b, DenseMatrix<Real>& x)
+      // solves Ax = b for DDG matrices
+      {
+         int m = b.nRows();
+         int n = b.nColumns();
+         Eigen::MatrixXd B( m, n );
+         for( int j = 0; j < n; j++ )
+         for( int i = 0; i < m; i++ )
+         {
+            B( i, j ) = b( i, j );
+         }
+
+         Eigen::MatrixXd X;
+         if( !solve( B, X )) return false;
+
+         x = DenseMatrix<Real>( m, n );
+         for( int j = 0; j < n; j++ )
+         for( int i = 0; i < m; i++ )
+         {
+            x( i, j ) = X( i, j );
+         }
+         return true;
+      }
+
+      double memory( void ) const
+      // returns the approximate size of the last factor in bytes (values
+      // plus row indices)
+      {
+         return factorNonZeros * ( sizeof(double) + sizeof(int) );
+      }
+
+      double factorTime;
+      // seconds spent in the last call to compute()
+
+      double solveTime;
+      // seconds spent in the last call to solve()
+
+      double factorNonZeros;
+      // number of nonzeros in the last factor (L and U for eigenLU)
+
+   protected:
+      Backend currentBackend;
+
+      std::unique_ptr< Eigen::SparseLU<spMat> > lu;
+      std::unique_ptr< Eigen::SimplicialLLT<spMat> > llt;
+      std::unique_ptr< Eigen::CholmodDecomposition<spMat> > cholmod;
+      // only the solver of the current backend is allocated, and only
+      // once compute() has been called
+
+      void clear( void )
+      {
+         lu.reset();
+         llt.reset();
+         cholmod.reset();
+         factorNonZeros = 0.;
+      }
+   };
+}
+
+#endif
@@ -1,7 +1,6 @@
 #include <vector>
 #include <Eigen/Dense>
 #include <Eigen/Sparse>
-#include <Eigen/CholmodSupport>
 
 #include "Types.h"
 #include "Mesh.h"
@@ -22,13 +21,15 @@ namespace DDG
         std::vector<T> tripletlist;
         tripletlist.reserve( 4 * mesh.halfedges.size() );
 
+        const MeshGeometry& geometry( mesh.geometry() );
+
         for (HalfEdgeCIter he = mesh.halfedges.begin(); he != mesh.halfedges.end(); he++)
         {
             if ( he->onBoundary ) {continue;}
 
             int origin = he->vertex->index;
             int target = he->next->vertex->index;
-            double cot_value = he->cotan() / 2.0 ;
+            double cot_value = geometry.cotan( he ) / 2.0 ;
 
             tripletlist.push_back( T(origin, target, cot_value) );
             tripletlist.push_back( T(target, origin, cot_value) );
@@ -44,8 +45,7 @@ namespace DDG
          * */
 
         /* construct solver */
-        negLapSolver.compute( -Laplacian );
-        if (negLapSolver.info() != Eigen::Success)
+        if ( !negLapSolver.compute( spMat( -Laplacian )) )
         {
             printf("fail to construct solver.\n");
         }
@@ -58,10 +58,11 @@ namespace DDG
        Vec phi(mesh.vertices.size());
        Vec A(mesh.vertices.size());  /* area of mesh */
        
+       const MeshGeometry& geometry( mesh.geometry() );
        for (VertexCIter v = mesh.vertices.begin(); v != mesh.vertices.end(); v++)
        {
            rho( v->index ) = v->rho;
-           A  ( v->index ) = v->area();
+           A  ( v->index ) = geometry.area( v );
        }
        
        /* make integration of rho on mesh to be 0 */
@@ -72,13 +73,12 @@ namespace DDG
 
        /* solve for 2-form of d*d rho */
        Vec hodgeRho = rho.array() * A.array();
-       phi = - negLapSolver.solve( hodgeRho );
-
-       if (negLapSolver.info() != Eigen::Success)
+       if ( !negLapSolver.solve( hodgeRho, phi ) )
        {
            printf("fail to solve equation.\n");
            return;
        }
+       phi = -phi;
 
        for (VertexIter v = mesh.vertices.begin(); v != mesh.vertices.end(); v++)
        {
@@ -111,15 +111,18 @@ namespace DDG
         area.reserve(mesh.vertices.size());
         for (VertexCIter v = mesh.vertices.begin(); v != mesh.vertices.end(); v++)
         {
-           area.push_back( T(v->index, v->index, v->area()) );
+           area.push_back( T(v->index, v->index, mesh.geometry().area( v )) );
         }
         A.resize(mesh.vertices.size(), mesh.vertices.size());
         A.setFromTriplets(area.begin(), area.end());
 
         /* curvature flow */
-        cholSolver solver;
-        solver.compute(A - h*Laplacian);
-        newPos = solver.solve(A*Pos);
+        if ( !flowSolver.compute( spMat(A - h*Laplacian) ) or
+             !flowSolver.solve( A*Pos, newPos ) )
+        {
+            printf("fail to solve equation.\n");
+            return;
+        }
 
         /* assign value to Pos */
         for (VertexIter v = mesh.vertices.begin(); v != mesh.vertices.end(); v++)
@@ -128,6 +131,7 @@ namespace DDG
             v->position[1] = newPos(v->index, 1);
             v->position[2] = newPos(v->index, 2);
         }
+        mesh.invalidateGeometry();
 
         printf("Assigned new position to vertices.\n");
     }
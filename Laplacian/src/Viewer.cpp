@@ -20,6 +20,7 @@ namespace DDG
    Camera Viewer::camera;
    Shader Viewer::shader;
    bool Viewer::renderWireframe = false;
+   Laplacian Viewer::Lap;
    
    void Viewer :: init( void )
    {
@@ -396,6 +397,8 @@ namespace DDG
    
    void Viewer :: drawPolygons( void )
    {
+      const MeshGeometry& geometry( mesh.geometry() );
+
       for( FaceCIter f  = mesh.faces.begin();
           f != mesh.faces.end();
           f ++ )
@@ -405,7 +408,7 @@ namespace DDG
          glBegin( GL_POLYGON );
          if( renderWireframe )
          {
-            Vector N = f->normal();
+            Vector N = geometry.normal( f );
             glNormal3dv( &N[0] );
          }
          
@@ -414,7 +417,7 @@ namespace DDG
          {
             if( not renderWireframe )
             {
-               Vector N = he->vertex->normal();
+               Vector N = geometry.normal( he->vertex );
                glNormal3dv( &N[0] );
             }
             
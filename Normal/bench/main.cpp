@@ -0,0 +1,40 @@
+// Benchmark driver: times the core stages of libDDG and all vertex normal
+// schemes on synthetic meshes (see Benchmark.h for options).  Build with
+// "make bench".
+
+#include <iostream>
+#include <vector>
+using namespace std;
+
+#include "CommandLine.h"
+#include "Benchmark.h"
+#include "Mesh.h"
+#include "Telemetry.h"
+#include "VertexNormals.h"
+using namespace DDG;
+
+int main( int argc, char** argv )
+{
+   CommandLine args( argc, argv );
+   Benchmark bench( args );
+
+   for( int i = 0; i < bench.nCases(); i++ )
+   {
+      Mesh mesh;
+      if( bench.load( i, mesh )) return 1;
+      bench.runCore( i, mesh );
+
+      VertexNormals normals;
+
+      for( int r = 0; r < bench.repeat(); r++ )
+      {
+         // all schemes from freshly computed geometry
+         mesh.invalidateGeometry();
+         Timer timer;
+         normals.build( mesh );
+         bench.record( i, "app", timer.elapsed() );
+      }
+   }
+
+   return bench.finish();
+}
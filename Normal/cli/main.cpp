@@ -0,0 +1,95 @@
+// Headless driver: computes vertex normals with the selected weighting and
+// writes them without opening a window (nothing here depends on OpenGL).
+// Build with "make cli".
+
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+using namespace std;
+
+#include "CommandLine.h"
+#include "Mesh.h"
+#include "MeshCurvature.h"
+#include "Telemetry.h"
+#include "Application.h"
+#include "VertexNormals.h"
+using namespace DDG;
+
+namespace DDG
+{
+   extern Telemetry telemetry;
+}
+
+int main( int argc, char** argv )
+{
+   CommandLine args( argc, argv );
+   if( args.nPositional() != 1 )
+   {
+      cerr << "usage: " << args.program() << " in.obj"
+           << " [--scheme=equal|area|angle|mean|sphere] [--normals=normals.txt] [--out=out.obj]"
+           << " [--curvatures=curvatures.txt]"
+           << " [--quiet] [--telemetry=stats.json]" << endl;
+      return 1;
+   }
+   telemetry.setQuiet( args.has( "quiet" ));
+
+   string scheme = args.value( "scheme", "equal" );
+   if     ( scheme == "equal" ) setNorm( Vertex::EQUAL );
+   else if( scheme == "area"  ) setNorm( Vertex::AREA  );
+   else if( scheme == "angle" ) setNorm( Vertex::ANGLE );
+   else if( scheme == "mean"  ) setNorm( Vertex::MEAN_CURVATURE );
+   else if( scheme == "sphere") setNorm( Vertex::SPHERE_INSCRIBED );
+   else
+   {
+      cerr << "Error: unknown scheme " << scheme << endl;
+      return 1;
+   }
+
+   Mesh mesh;
+   Timer timer;
+   if( mesh.read( args.positional( 0 ))) return 1;
+   telemetry.record( "cli.load", timer.elapsed() );
+   telemetry.print( "cli", "load", timer.elapsed(), "s" );
+
+   timer.start();
+   VertexNormals vertexNormals;
+   vertexNormals.build( mesh );
+   const vector<Vector>& N( vertexNormals[ Vertex::normState ] );
+   vector<double> normals;
+   normals.reserve( 3*N.size() );
+   for( size_t i = 0; i < N.size(); i++ )
+   {
+      normals.push_back( N[i].x );
+      normals.push_back( N[i].y );
+      normals.push_back( N[i].z );
+   }
+
+   // Gaussian, mean, minimum and maximum curvature per vertex
+   vector<double> curvatures;
+   if( args.has( "curvatures" ))
+   {
+      MeshCurvature curvature;
+      curvature.build( mesh );
+      curvatures.reserve( 4*mesh.vertices.size() );
+      for( size_t i = 0; i < mesh.vertices.size(); i++ )
+      {
+         curvatures.push_back( curvature.gaussCurvatures[i] );
+         curvatures.push_back( curvature.meanCurvatures[i] );
+         curvatures.push_back( curvature.minCurvatures[i] );
+         curvatures.push_back( curvature.maxCurvatures[i] );
+      }
+   }
+   telemetry.record( "cli.run", timer.elapsed() );
+   telemetry.print( "cli", "run", timer.elapsed(), "s" );
+
+   timer.start();
+   if( CommandLine::writeValues( args.value( "normals", "normals.txt" ), normals, 3 )) return 1;
+   if( mesh.write( args.value( "out", "out.obj" ))) return 1;
+   if( args.has( "curvatures" ) and
+       CommandLine::writeValues( args.value( "curvatures", "curvatures.txt" ), curvatures, 4 )) return 1;
+   telemetry.record( "cli.write", timer.elapsed() );
+   telemetry.print( "cli", "write", timer.elapsed(), "s" );
+
+   return args.writeTelemetry();
+}
@@ -35,8 +35,9 @@ namespace DDG
       double area( void ) const;
       // returns the barycentric area associated with this vertex
       
-      enum {EQUAL, AREA, ANGLE};
+      enum {EQUAL, AREA, ANGLE, MEAN_CURVATURE, SPHERE_INSCRIBED};
       static int normState;
+      // weighting scheme used by normal()
 
       Vector normal( void ) const;
       // returns the vertex normal
@@ -51,10 +52,13 @@ namespace DDG
       // return uni vertex normal using tip angle weights
 
       Vector normalMeanCurvature() const;
-      // return unit mean curvature normal \lapla f
+      // return unit mean curvature normal \lapla f, oriented like the
+      // area-weighted normal (which it falls back to where the mean
+      // curvature vanishes)
 
       Vector normalSphereInscribed() const;
-      // returns unit sphere-inscribed normal
+      // returns unit sphere-inscribed normal (Max's weights, exact for
+      // vertices sampled from a sphere)
       
       bool isIsolated( void ) const;
       // returns true if the vertex is not contained in any face or edge; false otherwise
@@ -0,0 +1,94 @@
+#ifndef DDG_VERTEX_NORMALS_H
+#define DDG_VERTEX_NORMALS_H
+
+#include <cmath>
+#include <vector>
+#include "Mesh.h"
+#include "MeshAdjacency.h"
+#include "MeshGeometry.h"
+#include "Parallel.h"
+
+namespace DDG
+{
+   class VertexNormals
+   // Computes all vertex normal schemes of Vertex at once.  The per-vertex
+   // functions rebuild the normal, area and corner angles of every incident
+   // triangle, so each triangle is evaluated about three times per scheme;
+   // here face normals, areas, angles and cotangents are read from the
+   // cached MeshGeometry, and one pass over the one rings (in parallel)
+   // accumulates all five sums per vertex, e.g.,
+   //
+   //    VertexNormals normals;
+   //    normals.build( mesh );
+   //    Vector N = normals[ Vertex::ANGLE ][ v->index ];
+   //
+   // Results agree with Vertex::normal() up to rounding.
+   {
+   public:
+      void build(const Mesh& mesh)
+      {
+         const MeshGeometry& geometry( mesh.geometry() );
+         const MeshAdjacency& adjacency( mesh.adjacency() );
+         int nV = mesh.vertices.size();
+         for( int s = 0; s < nSchemes; s++ )
+         {
+            normals[s].assign( nV, Vector() );
+         }
+
+         forEachVertexOneRing( adjacency, [&]( int i, int begin, int end )
+         {
+            if( begin == end ) return; // isolated
+
+            Vector p = mesh.vertices[i].position;
+            Vector equal, area, angle, laplace, sphere;
+            double scale = 0.;
+            for( int k = begin; k < end; k++ )
+            {
+               // edge term: cotan Laplacian of the position
+               double w = .5*( geometry.cotans[ adjacency.halfedge[k] ] +
+                               geometry.cotans[ adjacency.flip[k] ] );
+               Vector e1 = mesh.vertices[ adjacency.neighbor[k] ].position - p;
+               laplace -= w * e1;
+               scale += fabs(w) * e1.norm();
+
+               // face terms; the third corner of the face is the neighbor
+               // of the previous (clockwise) entry of the ring
+               int f = adjacency.face[k];
+               if( f < 0 ) continue;
+               const Vector& N( geometry.faceNormals[f] );
+               int previous = ( k == begin ? end : k ) - 1;
+               Vector e2 = mesh.vertices[ adjacency.neighbor[previous] ].position - p;
+               equal  += N;
+               area   += geometry.faceAreas[f] * N;
+               angle  += geometry.angles[ adjacency.next[k] ] * N;
+               sphere += cross( e1, e2 ) / ( e1.norm2() * e2.norm2() );
+            }
+
+            area = area.unit();
+            if( laplace.norm() <= 1e-8 * scale ) laplace = area;
+            else if( dot( laplace, area ) < 0. ) laplace = -laplace;
+
+            normals[ Vertex::EQUAL            ][i] = equal.unit();
+            normals[ Vertex::AREA             ][i] = area;
+            normals[ Vertex::ANGLE            ][i] = angle.unit();
+            normals[ Vertex::MEAN_CURVATURE   ][i] = laplace.unit();
+            normals[ Vertex::SPHERE_INSCRIBED ][i] = sphere.unit();
+         });
+      }
+
+      const std::vector<Vector>& operator[](int scheme) const
+      // returns the unit normals of the given scheme (Vertex::EQUAL, ...)
+      // per vertex index
+      {
+         return normals[ scheme ];
+      }
+
+      static const int nSchemes = Vertex::SPHERE_INSCRIBED + 1;
+
+   protected:
+      std::vector<Vector> normals[ nSchemes ];
+      // per scheme and vertex index
+   };
+}
+
+#endif
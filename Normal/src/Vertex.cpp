@@ -1,3 +1,4 @@
+#include <cmath>
 #include <vector>
 using namespace std;
 
@@ -33,6 +34,8 @@ namespace DDG
            case EQUAL: return this->normalEquallyWeighted();
            case AREA:  return this->normalAreaWeighted();
            case ANGLE: return this->normalAngleWeighted();
+           case MEAN_CURVATURE: return this->normalMeanCurvature();
+           case SPHERE_INSCRIBED: return this->normalSphereInscribed();
            default: return this->normalEquallyWeighted();
        }
    }
@@ -104,13 +107,49 @@ namespace DDG
    Vector Vertex::normalMeanCurvature() const
    // return unit mean curvature normal \lapla f
    {
-       return this->normal();
+      // -\Delta f = 2HN, accumulated with cotan weights
+      Vector N;
+      double scale = 0.;
+
+      HalfEdgeCIter h = he;
+      do
+      {
+         double w = .5*( h->cotan() + h->flip->cotan() );
+         Vector e = h->flip->vertex->position - position;
+         N -= w * e;
+         scale += fabs(w) * e.norm();
+         h = h->flip->next;
+      }
+      while( h != he );
+
+      // orient like the surface; use the area-weighted normal where the
+      // mean curvature vanishes (e.g., flat regions)
+      Vector NA = this->normalAreaWeighted();
+      if( N.norm() <= 1e-8 * scale ) return NA;
+      if( dot( N, NA ) < 0. ) N = -N;
+
+      return N.unit();
    }
 
    Vector Vertex::normalSphereInscribed() const
    // returns unit sphere-inscribed normal
    {
-       return this->normal();
+      Vector N;
+
+      HalfEdgeCIter h = he;
+      do
+      {
+         if (not h->onBoundary)
+         {
+            Vector e1 = h->next->vertex->position - position;
+            Vector e2 = h->next->next->vertex->position - position;
+            N += cross( e1, e2 ) / ( e1.norm2() * e2.norm2() );
+         }
+         h = h->flip->next;
+      }
+      while( h != he );
+
+      return N.unit();
    }
 
    vector<HalfEdge> isolated; // all isolated vertices point to isolated.begin()
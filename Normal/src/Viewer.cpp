@@ -10,6 +10,7 @@ using namespace std;
 #include "Viewer.h"
 #include "Image.h"
 #include "Application.h"
+#include "VertexNormals.h"
 
 namespace DDG
 {
@@ -149,6 +150,12 @@ namespace DDG
          case '3':
             mProcess(2);
             break;
+         case '4':
+            mProcess(3);
+            break;
+         case '5':
+            mProcess(4);
+            break;
          default:
             break;
       }
@@ -395,6 +402,12 @@ namespace DDG
    
    void Viewer :: drawPolygons( void )
    {
+      const MeshGeometry& geometry( mesh.geometry() );
+
+      VertexNormals normals;
+      if( not renderWireframe ) normals.build( mesh );
+      const vector<Vector>& vertexNormals( normals[ Vertex::normState ] );
+
       for( FaceCIter f  = mesh.faces.begin();
           f != mesh.faces.end();
           f ++ )
@@ -404,7 +417,7 @@ namespace DDG
          glBegin( GL_POLYGON );
          if( renderWireframe )
          {
-            Vector N = f->normal();
+            Vector N = geometry.normal( f );
             glNormal3dv( &N[0] );
          }
          
@@ -413,7 +426,7 @@ namespace DDG
          {
             if( not renderWireframe )
             {
-               Vector N = he->vertex->normal();
+               const Vector& N( vertexNormals[ he->vertex->index ] );
                glNormal3dv( &N[0] );
             }
             
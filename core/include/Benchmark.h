@@ -0,0 +1,138 @@
+// -----------------------------------------------------------------------------
+// libDDG -- Benchmark.h
+// -----------------------------------------------------------------------------
+//
+// Benchmark runs the core stages of libDDG on synthetic meshes of controlled
+// size (see MeshGenerator) and records their wall-clock times in Telemetry
+// under "bench.<case>.<stage>", e.g., "bench.torus-100k.factorize".  The cases
+// are every combination of
+//
+//    --shapes=sphere,torus,disc,scan   shapes to generate
+//    --faces=1000,10000,100000         approximate face counts
+//    --genus=2                         genus of the torus
+//
+//    --orders=input                    element orders (see MeshOrdering)
+//
+// and each stage is repeated --repeat=3 times; thresholds and summaries use the
+// fastest repetition.  Generated meshes are written to --dir=. and deleted
+// afterwards unless --keep is given; solvers are silent unless --verbose is
+// given.  The stages are
+//
+//    reorder     permuting the mesh elements into the requested order, after
+//                which the mesh is written back to disk in that order
+//    load        reading the generated OBJ file from disk, which splits into
+//    parse         tokenizing the file and
+//    build         building the halfedge mesh
+//    adjacency   collecting the one rings of all vertices (see MeshAdjacency)
+//    geometry    computing cotangents, areas, normals, etc.
+//    dec         assembling star0, star1, d0 and the Laplacian d0^T star1 d0
+//    multiply    one Laplacian-vector product
+//    factorize   symbolic and numerical Cholesky factorization
+//    refactor    numerical factorization only
+//    backsolve   one solve with the factor
+//    eigen       smallest generalized eigenvector of the Laplacian
+//
+// plus whatever the driver times itself via record(), usually the end-to-end
+// run of its Application ("app").  When done, finish() prints a summary table,
+// writes the telemetry to --telemetry=bench.json (or .csv), and compares
+// against regression thresholds.  A thresholds file lists one "name seconds"
+// pair per line ('#' starts a comment); it is typically created on a
+// reference machine via
+//
+//    fairing-bench --baseline=thresholds.txt --margin=0.5
+//
+// which allows each stage to be 50% slower than measured, and checked later by
+//
+//    fairing-bench --thresholds=thresholds.txt
+//
+// which returns nonzero if any stage exceeds its threshold.  Cases with an order
+// other than "input" are named after it, e.g., "scan-100k-hilbert"; comparing
+// them with "scan-100k" shows what the order buys for, e.g., dec and multiply.
+//
+
+#ifndef DDG_BENCHMARK_H
+#define DDG_BENCHMARK_H
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include "CommandLine.h"
+#include "MeshOrdering.h"
+
+namespace DDG
+{
+   class Mesh;
+
+   class Benchmark
+   {
+   public:
+      Benchmark( const CommandLine& args );
+      // sets up the cases requested on the command line
+
+      ~Benchmark( void );
+      // removes the last generated mesh file
+
+      int nCases( void ) const;
+      // returns the number of cases
+
+      const std::string& name( int i ) const;
+      // returns the name of case i, e.g., "sphere-10k"
+
+      const std::string& shape( int i ) const;
+      // returns the shape of case i ("sphere", "torus", "disc" or "scan")
+
+      bool hasBoundary( int i ) const;
+      // returns true if the mesh of case i has boundary
+
+      int repeat( void ) const;
+      // returns the number of times each stage should be run
+
+      int load( int i, Mesh& mesh );
+      // generates the mesh of case i, writes it to disk and reads it back
+      // (repeat() times); the file stays on disk until the next call, so
+      // mesh.reload() restores the original mesh.  Return value is nonzero
+      // only if there was an error
+
+      const std::string& meshFile( void ) const;
+      // returns the file written by the most recent call to load()
+
+      void runCore( int i, Mesh& mesh );
+      // times the core stages on mesh, which is left unchanged
+
+      void record( int i, const std::string& stage, double seconds );
+      // records one sample of the given stage of case i
+
+      int finish( void ) const;
+      // prints a summary, writes telemetry and baseline, and checks
+      // thresholds; return value is nonzero if a stage exceeded its
+      // threshold or if there was an error
+
+   protected:
+      struct Case
+      {
+         std::string shape;
+         std::string name;
+         int nFaces;
+         MeshOrdering::Strategy order;
+      };
+
+      void generate( const Case& c, std::ostream& out ) const;
+      int writeBaseline( const std::string& filename, double margin ) const;
+      int checkThresholds( const std::string& filename ) const;
+
+      CommandLine args;
+      std::vector<Case> cases;
+      int nRepeat;
+      int genus;
+
+      std::string filename;
+      // most recently generated mesh file
+
+      std::vector<std::string> stages;
+      // stage names in the order they were first recorded
+   };
+}
+
+#endif
+
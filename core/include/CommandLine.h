@@ -0,0 +1,82 @@
+// -----------------------------------------------------------------------------
+// libDDG -- CommandLine.h
+// -----------------------------------------------------------------------------
+//
+// CommandLine splits the arguments of a headless driver into positional
+// arguments and named options.  Options have the form "--name=value", or just
+// "--name" for a switch; everything else is positional.  For example,
+//
+//    fairing-cli bunny.obj --out=smooth.obj --step=0.01 --steps=10 --quiet
+//
+// is read via
+//
+//    CommandLine args( argc, argv );
+//    std::string in  = args.positional( 0 );
+//    std::string out = args.value( "out", "out.obj" );
+//    double step     = args.value( "step", 0.01 );
+//    int nSteps      = args.value( "steps", 1 );
+//    bool quiet      = args.has( "quiet" );
+//
+// The same class also carries the few chores every driver shares: writing
+// per-element values to disk and saving solver telemetry.
+//
+
+#ifndef DDG_COMMANDLINE_H
+#define DDG_COMMANDLINE_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace DDG
+{
+   class CommandLine
+   {
+   public:
+      CommandLine( int argc, char** argv );
+      // parses the arguments of main()
+
+      const std::string& program( void ) const;
+      // returns the name of the executable
+
+      int nPositional( void ) const;
+      // returns the number of positional arguments
+
+      const std::string& positional( int i ) const;
+      // returns the ith positional argument
+
+      bool has( const std::string& name ) const;
+      // returns true if option --name was given (with or without a value)
+
+      std::string value( const std::string& name, const char* defaultValue ) const;
+      std::string value( const std::string& name, const std::string& defaultValue ) const;
+      double value( const std::string& name, double defaultValue ) const;
+      int value( const std::string& name, int defaultValue ) const;
+      // returns the value of option --name, or defaultValue if it was not given
+
+      std::vector<std::string> list( const std::string& name ) const;
+      // returns the comma-separated list given as --name=a,b,c
+
+      std::vector<int> indices( const std::string& name ) const;
+      // returns the comma-separated list of integers given as --name=i,j,k
+
+      int writeTelemetry( void ) const;
+      // writes all solver statistics to the file given as --telemetry (as
+      // CSV if its name ends in ".csv" and JSON otherwise); return value is
+      // nonzero only if there was an error
+
+      static int writeValues( const std::string& filename,
+                              const std::vector<double>& values,
+                              int nColumns = 1 );
+      // writes values to a text file, nColumns per line; return value is
+      // nonzero only if there was an error
+
+   protected:
+      std::string programName;
+      std::vector<std::string> arguments;
+      std::map<std::string,std::string> options;
+   };
+}
+
+#endif
+
@@ -0,0 +1,103 @@
+// -----------------------------------------------------------------------------
+// libDDG -- GeometryKernels.h
+// -----------------------------------------------------------------------------
+//
+// GeometryKernels evaluates basic triangle geometry -- unit normals, areas,
+// corner cotangents and edge lengths -- for many elements at once.  Rather
+// than going through Vector one element at a time, the kernels read vertex
+// coordinates from separate x, y and z arrays ("structure of arrays") and
+// process four (AVX2) or eight (AVX-512) elements per instruction.  The
+// instruction set is detected at run time, so the same binary runs on any
+// x86-64 processor; on other platforms (or other compilers) a portable scalar
+// version is used.  Normally these kernels are called for you by
+// MeshGeometry::build(), e.g.,
+//
+//    GeometryKernels::Points points = { &x[0], &y[0], &z[0] };
+//    GeometryKernels::Triangles triangles = { nF, &i0[0], &i1[0], &i2[0] };
+//    GeometryKernels::TriangleGeometry out = { ... };
+//    GeometryKernels::faceGeometry( points, triangles, out );
+//
+// The variant can be forced via setInstructionSet(), which is mostly useful
+// for benchmarking and for checking the vector paths against the scalar one.
+//
+
+#ifndef DDG_GEOMETRYKERNELS_H
+#define DDG_GEOMETRYKERNELS_H
+
+namespace DDG
+{
+   class GeometryKernels
+   {
+   public:
+      enum InstructionSet
+      {
+         scalar,
+         avx2,
+         avx512
+      };
+
+      struct Points
+      {
+         const double* x;
+         const double* y;
+         const double* z;
+      };
+      // vertex coordinates
+
+      struct Triangles
+      {
+         int size;
+         const int* i0;
+         const int* i1;
+         const int* i2;
+      };
+      // vertex indices of the three corners of each triangle
+
+      struct TriangleGeometry
+      {
+         double* nx;
+         double* ny;
+         double* nz;
+         // unit normal, oriented by corner order
+
+         double* area;
+         // triangle area
+
+         double* cot0;
+         double* cot1;
+         double* cot2;
+         // cotangent of the angle opposing the edge from corner k
+         // to corner k+1, i.e., the angle at corner k+2
+      };
+      // per-triangle output arrays (each of length Triangles::size)
+
+      static void faceGeometry( const Points& points,
+                                const Triangles& triangles,
+                                TriangleGeometry& geometry );
+      // computes normals, areas and cotangents of all triangles
+
+      static void edgeLengths( const Points& points,
+                               int size,
+                               const int* i0,
+                               const int* i1,
+                               double* length );
+      // computes the distance between points i0[k] and i1[k] for
+      // k = 0, ..., size-1
+
+      static InstructionSet instructionSet( void );
+      // returns the variant used by the kernels (the best one
+      // supported by this processor, unless overridden)
+
+      static void setInstructionSet( InstructionSet set );
+      // overrides the variant; ignored if set is not supported
+
+      static bool isSupported( InstructionSet set );
+      // returns true if set can run on this processor
+
+      static const char* name( InstructionSet set );
+      // returns a human-readable name for set
+   };
+}
+
+#endif
+
@@ -0,0 +1,112 @@
+// -----------------------------------------------------------------------------
+// libDDG -- LinearContext.h
+// -----------------------------------------------------------------------------
+//
+// LinearContext is the solver context needed to interface with the SuiteSparse
+// library.  It is essentially a wrapper around cholmod_common.  A thread-local
+// instance of LinearContext is declared in LinearContext.cpp and is shared by
+// all instances of DenseMatrix, SparseMatrix, SparseFactor, and LinearSystem
+// used on that thread; the main thread's instance is never destroyed, so that
+// static matrices can still be freed at exit.  Independent problems can be
+// solved concurrently from several worker threads, as long as each matrix or
+// factor is only used by one thread at a time.  In other words, you shouldn't have to
+// instantiate LinearContext yourself unless you're doing something really
+// fancy!
+//
+// Solver behavior is controlled through LinearContext::Options.  Options set
+// via setDefaultOptions() are picked up by every context created afterwards
+// (e.g., the contexts of worker threads that have not yet solved anything);
+// options set via setOptions() affect only the calling thread:
+//
+//    LinearContext::Options options;
+//    options.factorization = LinearContext::supernodal;
+//    options.nThreads = 4;
+//    LinearContext::setDefaultOptions( options );
+//
+// The number of threads used inside BLAS itself is controlled by the BLAS
+// implementation (e.g., OPENBLAS_NUM_THREADS or OMP_NUM_THREADS); when solving
+// many problems in parallel it is usually best to leave that at one.
+//
+
+#ifndef DDG_LINEARSOLVERCONTEXT
+#define DDG_LINEARSOLVERCONTEXT
+
+#include <cholmod.h>
+
+namespace DDG
+{
+   class LinearContext
+   {
+      public:
+         enum Factorization
+         {
+            simplicial = CHOLMOD_SIMPLICIAL,
+            automatic  = CHOLMOD_AUTO,
+            supernodal = CHOLMOD_SUPERNODAL
+         };
+         // Cholesky factorization variants; automatic lets CHOLMOD pick
+         // supernodal once flops/nnz(L) exceeds supernodalSwitch
+
+         enum Ordering
+         {
+            orderingDefault,
+            orderingAMD,
+            orderingMETIS,
+            orderingNESDIS,
+            orderingNatural
+         };
+         // fill-reducing orderings; orderingDefault lets CHOLMOD try AMD
+         // and METIS and keep the better one
+
+         struct Options
+         {
+            Options( void );
+            // CHOLMOD defaults
+
+            Factorization factorization;
+            // simplicial, supernodal or automatic selection
+
+            double supernodalSwitch;
+            // flops/nnz(L) ratio above which automatic selects supernodal
+
+            Ordering ordering;
+            // fill-reducing ordering used by cholmod_l_analyze
+
+            int nThreads;
+            // maximum number of threads used by CHOLMOD and SuiteSparseQR
+            // (zero means "library default")
+         };
+
+         LinearContext( void );
+         // constructor; uses the current default options
+
+         ~LinearContext( void );
+         // destructor
+
+         operator cholmod_common*( void );
+         // allows LinearContext to be treated as a cholmod_common*
+
+         void setOptions( const Options& options );
+         // applies options to this context
+
+         const Options& options( void ) const;
+         // returns the options of this context
+
+         static void setDefaultOptions( const Options& options );
+         // sets the options of contexts constructed from now on
+
+         static Options defaultOptions( void );
+         // returns the options used by newly constructed contexts
+
+      protected:
+         cholmod_common context;
+         Options currentOptions;
+
+         LinearContext( const LinearContext& );
+         const LinearContext& operator=( const LinearContext& );
+         // contexts own CHOLMOD workspace and cannot be copied
+   };
+}
+
+#endif
+
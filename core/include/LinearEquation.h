@@ -30,8 +30,9 @@ namespace DDG
          // right-hand side
    };
 
-   LinearEquation operator==( const LinearPolynomial& lhs, const LinearPolynomial& rhs );
+   LinearEquation operator==( LinearPolynomial lhs, LinearPolynomial rhs );
    // constructs a linear equation with the specified left- and right-hand side
+   // (temporaries are moved into the equation rather than copied)
 }
 
 #endif
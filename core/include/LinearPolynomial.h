@@ -16,14 +16,22 @@
 // while the polynomial is still in use -- LinearPolynomial stores only a
 // reference to these variables so that the solution to a linear system can be
 // automatically copied back into the variables.
+//
+// Linear terms are stored in a TermList, which keeps short polynomials entirely
+// on the stack.  Operators that take a temporary polynomial as their first
+// argument reuse its storage, so an expression like
+//
+//    LinearPolynomial p = 2*x + 3*y - z + 1;
+//
+// builds the result in place rather than copying it at every step.
 // 
 
 #ifndef DDG_LINEARPOLYNOMIAL_H
 #define DDG_LINEARPOLYNOMIAL_H
 
-#include <map>
 #include <iosfwd>
 #include "Variable.h"
+#include "TermList.h"
 
 namespace DDG
 {
@@ -59,13 +67,17 @@ namespace DDG
          void operator-=( const LinearPolynomial& p );
          // increments or decrements by an affine function
 
-         LinearPolynomial operator-( void ) const;
+         void accumulate( const LinearPolynomial& p, double s );
+         // increments by s times the affine function p
+
+         LinearPolynomial operator-( void ) const&;
+         LinearPolynomial operator-( void ) &&;
          // returns the additive inverse (i.e., negation)
 
          double evaluate( void ) const;
          // evaluates the function using the current values of its variables
 
-         std::map<Variable*,double> linearTerms;
+         TermList linearTerms;
          // list of linear terms
 
          double constantTerm;
@@ -92,17 +104,35 @@ namespace DDG
    LinearPolynomial operator*( const LinearPolynomial& p, double c ); // product
    LinearPolynomial operator*( double c, const LinearPolynomial& p ); // product
    LinearPolynomial operator/( const LinearPolynomial& p, double c ); // quotient
+   LinearPolynomial operator+( LinearPolynomial&& p, double c ); // sum
+   LinearPolynomial operator+( double c, LinearPolynomial&& p ); // sum
+   LinearPolynomial operator-( LinearPolynomial&& p, double c ); // difference
+   LinearPolynomial operator-( double c, LinearPolynomial&& p ); // difference
+   LinearPolynomial operator*( LinearPolynomial&& p, double c ); // product
+   LinearPolynomial operator*( double c, LinearPolynomial&& p ); // product
+   LinearPolynomial operator/( LinearPolynomial&& p, double c ); // quotient
    // algebraic operations between polynomials and constants
 
    LinearPolynomial operator+( const LinearPolynomial& p, Variable& v ); // sum
    LinearPolynomial operator+( Variable& v, const LinearPolynomial& p ); // sum
    LinearPolynomial operator-( const LinearPolynomial& p, Variable& v ); // difference
    LinearPolynomial operator-( Variable& v, const LinearPolynomial& p ); // difference
+   LinearPolynomial operator+( LinearPolynomial&& p, Variable& v ); // sum
+   LinearPolynomial operator+( Variable& v, LinearPolynomial&& p ); // sum
+   LinearPolynomial operator-( LinearPolynomial&& p, Variable& v ); // difference
+   LinearPolynomial operator-( Variable& v, LinearPolynomial&& p ); // difference
    // algebraic operations between polynomials and single variables
 
    LinearPolynomial operator+( const LinearPolynomial& p, const LinearPolynomial& q ); // sum
    LinearPolynomial operator-( const LinearPolynomial& p, const LinearPolynomial& q ); // difference
+   LinearPolynomial operator+( LinearPolynomial&& p, const LinearPolynomial& q ); // sum
+   LinearPolynomial operator+( const LinearPolynomial& p, LinearPolynomial&& q ); // sum
+   LinearPolynomial operator+( LinearPolynomial&& p, LinearPolynomial&& q ); // sum
+   LinearPolynomial operator-( LinearPolynomial&& p, const LinearPolynomial& q ); // difference
+   LinearPolynomial operator-( const LinearPolynomial& p, LinearPolynomial&& q ); // difference
+   LinearPolynomial operator-( LinearPolynomial&& p, LinearPolynomial&& q ); // difference
    // algebraic operations between pairs of polynomials
+   // (overloads taking an rvalue reuse the storage of that argument)
 
    std::ostream& operator<<( std::ostream& os, const LinearPolynomial& p );
    // prints the symbolic representation of a polynomial (all variables must be named)
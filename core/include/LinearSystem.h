@@ -41,6 +41,7 @@ namespace DDG
          // removes all equations from the system
 
          void push_back( const LinearEquation& e );
+         void push_back( LinearEquation&& e );
          // appends the equation e to the sytem
 
          void solve( void );
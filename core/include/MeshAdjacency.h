@@ -0,0 +1,97 @@
+// -----------------------------------------------------------------------------
+// libDDG -- MeshAdjacency.h
+// -----------------------------------------------------------------------------
+//
+// MeshAdjacency stores the one ring of every vertex in flat arrays ("compressed
+// sparse rows"): the outgoing halfedges of the vertex with index i are entries
+// offsets[i], ..., offsets[i+1]-1, listed in the order of the usual traversal
+//
+//    HalfEdgeIter h = v->he;
+//    do
+//    {
+//       // ...
+//       h = h->flip->next;
+//    }
+//    while( h != v->he );
+//
+// For each entry k the arrays hold the position of the outgoing halfedge h in
+// Mesh::halfedges (also the index into per-halfedge MeshGeometry arrays), of
+// h->flip and h->next, the index of the neighboring vertex h->flip->vertex and
+// the index of the face h->face (-1 if h lies on a boundary loop).  One-ring
+// algorithms can thus stream through contiguous arrays instead of following a
+// chain of dependent pointers.  The helper forEachVertexOneRing() visits all
+// vertices in parallel:
+//
+//    const MeshAdjacency& adjacency( mesh.adjacency() );
+//    forEachVertexOneRing( adjacency, [&]( int i, int begin, int end )
+//    {
+//       double sum = 0.;
+//       for( int k = begin; k < end; k++ )
+//       {
+//          sum += u( adjacency.neighbor[k] ) - u( i );
+//       }
+//       result( i ) = sum;   // only write to entry i
+//    });
+//
+// Normally you will not build a MeshAdjacency yourself but ask the mesh for its
+// cached copy, which is rebuilt whenever the mesh is read or reordered; code
+// that edits connectivity must call Mesh::invalidateConnectivity().
+//
+
+#ifndef DDG_MESHADJACENCY_H
+#define DDG_MESHADJACENCY_H
+
+#include <vector>
+
+#include "Types.h"
+#include "Parallel.h"
+
+namespace DDG
+{
+   class MeshAdjacency
+   {
+   public:
+      void build( const Mesh& mesh );
+      // collects the one rings of all vertices of mesh
+
+      void clear( void );
+      // releases all storage
+
+      int nVertices( void ) const;
+      // returns the number of vertices
+
+      int valence( int i ) const;
+      // returns the number of outgoing halfedges of vertex i
+
+      std::vector<int> offsets;
+      // entries of vertex i are offsets[i], ..., offsets[i+1]-1
+
+      std::vector<int> halfedge;
+      std::vector<int> flip;
+      std::vector<int> next;
+      // positions of h, h->flip and h->next in Mesh::halfedges
+
+      std::vector<int> neighbor;
+      // index of h->flip->vertex
+
+      std::vector<int> face;
+      // index of h->face, or -1 if h is on a boundary loop
+   };
+
+   template <class Body>
+   void forEachVertexOneRing( const MeshAdjacency& adjacency, const Body& body, int grain = 1024 )
+   // calls body( i, begin, end ) for every vertex index i, where begin and
+   // end delimit the entries of i; vertices are processed in parallel, so
+   // body may only write to data owned by vertex i
+   {
+      parallelFor( 0, adjacency.nVertices(), [&]( int b, int e )
+      {
+         for( int i = b; i < e; i++ )
+         {
+            body( i, adjacency.offsets[i], adjacency.offsets[i+1] );
+         }
+      }, grain );
+   }
+}
+
+#endif
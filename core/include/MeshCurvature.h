@@ -0,0 +1,78 @@
+// -----------------------------------------------------------------------------
+// libDDG -- MeshCurvature.h
+// -----------------------------------------------------------------------------
+//
+// MeshCurvature evaluates discrete curvatures at every vertex of a triangle
+// mesh and stores them in flat arrays indexed by vertex index:
+//
+//    -- the angle defect 2pi - sum of tip angles (pi - sum on the boundary,
+//       i.e., the turning angle of the boundary curve), which is the
+//       Gaussian curvature integrated over the dual cell,
+//    -- the mean curvature normal HN = -1/2 Delta f, where Delta is the
+//       cotan Laplacian divided by the barycentric vertex area, and
+//    -- the principal curvatures and directions, taken from the shape
+//       operator of Cohen-Steiner and Morvan: every edge ij contributes
+//       half its length times its signed dihedral angle to a tensor in the
+//       tangent plane, which bends the surface across (not along) the edge.
+//
+// All quantities are computed from the cached MeshGeometry and MeshAdjacency
+// in a single parallel sweep over the one rings, e.g.,
+//
+//    MeshCurvature curvature;
+//    curvature.build( mesh );
+//    for( int i = 0; i < nV; i++ )
+//    {
+//       double K = curvature.gaussCurvatures[i];
+//       double H = curvature.meanCurvatures[i];
+//       // ...
+//    }
+//
+// Signs follow the vertex normals of MeshGeometry: a sphere with outward
+// normals has positive mean and principal curvatures.  The shape operator
+// is not meaningful at boundary vertices, where edges without a second
+// face do not contribute.
+//
+
+#ifndef DDG_MESHCURVATURE_H
+#define DDG_MESHCURVATURE_H
+
+#include <vector>
+
+#include "Vector.h"
+#include "Types.h"
+
+namespace DDG
+{
+   class MeshCurvature
+   {
+   public:
+      void build( const Mesh& mesh );
+      // computes all quantities for the current state of mesh
+
+      void clear( void );
+      // releases all storage
+
+      std::vector<double> angleDefects;
+      // integrated Gaussian curvature
+
+      std::vector<double> gaussCurvatures;
+      // angle defect per unit (barycentric) area
+
+      std::vector<Vector> meanCurvatureNormals;
+      // HN, from the cotan Laplacian
+
+      std::vector<double> meanCurvatures;
+      // H, signed length of HN relative to the vertex normal
+
+      std::vector<double> minCurvatures;
+      std::vector<double> maxCurvatures;
+      // principal curvatures from the shape operator (min <= max)
+
+      std::vector<Vector> minDirections;
+      std::vector<Vector> maxDirections;
+      // corresponding unit principal directions, tangent to the vertex normal
+   };
+}
+
+#endif
+
@@ -0,0 +1,53 @@
+// -----------------------------------------------------------------------------
+// libDDG -- MeshGenerator.h
+// -----------------------------------------------------------------------------
+//
+// MeshGenerator writes synthetic triangle meshes as Wavefront OBJ, so that
+// benchmarks can run at any scale without shipping large data files.  Every
+// mesh is a deterministic function of its parameters (noise is drawn from a
+// seeded generator), so the same call always produces the same file:
+//
+//    sphere( out, level )     subdivided icosahedron, 20*4^level faces
+//    torus( out, genus, n )   closed surface of the given genus, roughly
+//                             7*genus*n^2 faces (n >= 6)
+//    disc( out, n )           planar unit disc with boundary, 6*n^2 faces
+//    scan( out, level, ... )  sphere with radial noise and vertices in
+//                             random order, as produced by a scanner
+//
+// For a given face count, the resolution parameter is returned by the
+// corresponding *Resolution() method.
+//
+
+#ifndef DDG_MESHGENERATOR_H
+#define DDG_MESHGENERATOR_H
+
+#include <iosfwd>
+
+namespace DDG
+{
+   class MeshGenerator
+   {
+   public:
+      static void sphere( std::ostream& out, int level );
+      // writes the level-times subdivided icosahedron projected to the unit sphere
+
+      static void torus( std::ostream& out, int genus, int n );
+      // writes a closed surface of the given genus: a plate with genus
+      // square holes, each unit square of the plate sampled by n x n cells
+
+      static void disc( std::ostream& out, int n );
+      // writes the unit disc in the xy-plane, triangulated by n concentric rings
+
+      static void scan( std::ostream& out, int level, double noise = .3, unsigned seed = 1 );
+      // writes a level-times subdivided sphere whose vertices are displaced
+      // radially by up to noise times the edge length and listed in random order
+
+      static int sphereResolution( int nFaces );
+      static int torusResolution( int nFaces, int genus );
+      static int discResolution( int nFaces );
+      // returns the resolution parameter that gives closest to nFaces faces
+   };
+}
+
+#endif
+
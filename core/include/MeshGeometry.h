@@ -0,0 +1,110 @@
+// -----------------------------------------------------------------------------
+// libDDG -- MeshGeometry.h
+// -----------------------------------------------------------------------------
+//
+// MeshGeometry caches per-element geometric quantities of a triangle mesh --
+// cotangents, angles, edge lengths, face areas, normals and circumcenters, and
+// vertex areas and normals -- in flat arrays indexed by element index.  All
+// quantities are computed in a single sweep over the faces, so that each
+// triangle is visited exactly once no matter how many quantities are used;
+// the per-triangle arithmetic is done by the vectorized GeometryKernels.
+//
+// Normally you will not build a MeshGeometry yourself but ask the mesh for its
+// cached copy, which is (re)built on demand:
+//
+//    const MeshGeometry& geometry( mesh.geometry() );
+//    for( EdgeCIter e = mesh.edges.begin(); e != mesh.edges.end(); e++ )
+//    {
+//       double w = geometry.cotan( e->he ) + geometry.cotan( e->he->flip );
+//       // ...
+//    }
+//
+// The cache is NOT updated automatically -- code that moves vertices or edits
+// connectivity must call Mesh::invalidateGeometry() afterwards.  Halfedges
+// carry no index of their own; halfedge quantities are stored in the order of
+// Mesh::halfedges.  Quantities of a halfedge on a boundary loop are zero.
+//
+
+#ifndef DDG_MESHGEOMETRY_H
+#define DDG_MESHGEOMETRY_H
+
+#include <vector>
+
+#include "Vector.h"
+#include "Types.h"
+
+namespace DDG
+{
+   class MeshGeometry
+   {
+   public:
+      MeshGeometry( void );
+      // constructs an empty cache
+
+      void build( const Mesh& mesh );
+      // computes all quantities for the current state of mesh
+
+      void clear( void );
+      // releases all storage
+
+      double cotan( HalfEdgeCIter h ) const;
+      // returns the cotangent of the angle opposing h
+
+      double angle( HalfEdgeCIter h ) const;
+      // returns the angle opposing h
+
+      double length( EdgeCIter e ) const;
+      // returns the length of e
+
+      double area( FaceCIter f ) const;
+      // returns the area of f
+
+      const Vector& normal( FaceCIter f ) const;
+      // returns the unit normal of f
+
+      const Vector& circumcenter( FaceCIter f ) const;
+      // returns the circumcenter of f
+
+      double area( VertexCIter v ) const;
+      // returns the barycentric dual area of v
+
+      const Vector& normal( VertexCIter v ) const;
+      // returns the unit vertex normal of v (normalized sum of the
+      // incident face normals)
+
+      int index( HalfEdgeCIter h ) const;
+      // returns the position of h in the halfedge arrays
+
+      std::vector<double> cotans;
+      std::vector<double> angles;
+      // per halfedge
+
+      std::vector<double> edgeLengths;
+      // per edge
+
+      std::vector<double> faceAreas;
+      std::vector<Vector> faceNormals;
+      std::vector<Vector> circumcenters;
+      // per face
+
+      std::vector<double> vertexAreas;
+      std::vector<Vector> vertexNormals;
+      // per vertex
+
+   protected:
+      const HalfEdge* firstHalfEdge;
+      // address of the first halfedge of the mesh that was built
+
+      std::vector<double> x, y, z;
+      std::vector<int> tail, head;
+      std::vector<int> corner[3];
+      std::vector<int> faceHalfEdge[3];
+      std::vector<double> cornerCotans[3];
+      std::vector<double> unitNormal[3];
+      // flat copies of coordinates, connectivity and per-corner results
+      // (kept between builds to avoid reallocation)
+   };
+}
+
+#endif
+
@@ -0,0 +1,88 @@
+// -----------------------------------------------------------------------------
+// libDDG -- MeshOrdering.h
+// -----------------------------------------------------------------------------
+//
+// MeshOrdering permutes the elements of a mesh to improve memory locality.  By
+// default elements are stored in the order of the input file, which for
+// scanned data is essentially random: neighboring vertices end up far apart in
+// memory, one-ring traversals and sparse matrix-vector products miss the
+// cache, and the fill of a Cholesky factorization depends on the input order.
+// Vertices can be sorted by
+//
+//    morton    the Morton (Z-order) code of their position
+//    hilbert   the index of their position along a Hilbert curve
+//    bfs       breadth-first traversal of the vertex graph
+//    rcm       reverse Cuthill-McKee, which minimizes the matrix bandwidth
+//
+// Faces are sorted by the same curve as the vertices (morton, hilbert) or by
+// their first vertex in the new order (bfs, rcm); halfedges are then stored
+// face by face in circulation order, followed by the boundary loops, and edges
+// in the order their halfedges first appear.  Usually all you need is
+//
+//    mesh.reorder( MeshOrdering::hilbert );
+//
+// which permutes the elements in place, updates all iterators stored in the
+// mesh and reassigns element indices.  Code that keeps iterators elsewhere can
+// build() and apply() an ordering itself and update them with map().
+//
+
+#ifndef DDG_MESHORDERING_H
+#define DDG_MESHORDERING_H
+
+#include <string>
+#include <vector>
+
+#include "Types.h"
+
+namespace DDG
+{
+   class MeshOrdering
+   {
+   public:
+      enum Strategy
+      {
+         inputOrder,
+         morton,
+         hilbert,
+         breadthFirst,
+         reverseCuthillMcKee
+      };
+
+      static bool parse( const std::string& name, Strategy& strategy );
+      // sets strategy to the strategy called name ("input", "morton",
+      // "hilbert", "bfs" or "rcm"); returns false if there is no such strategy
+
+      static std::string name( Strategy strategy );
+      // returns the name of strategy as accepted by parse()
+
+      void build( const Mesh& mesh, Strategy strategy );
+      // computes the new position of every element of mesh
+
+      void apply( Mesh& mesh ) const;
+      // moves every element of mesh to its new position and updates the
+      // iterators stored in mesh elements; the storage of the element arrays
+      // is reused, so iterators held elsewhere still point to the old
+      // position until they are passed through map()
+
+      HalfEdgeIter map( Mesh& mesh, HalfEdgeIter h ) const;
+      VertexIter   map( Mesh& mesh, VertexIter   v ) const;
+      EdgeIter     map( Mesh& mesh, EdgeIter     e ) const;
+      FaceIter     map( Mesh& mesh, FaceIter     f ) const;
+      // returns the new position of an element given its position before
+      // apply(); boundary loops keep their position
+
+      std::vector<int> halfedgeIndex;
+      std::vector<int> vertexIndex;
+      std::vector<int> edgeIndex;
+      std::vector<int> faceIndex;
+      // new position of the element at each old position
+
+   protected:
+      void orderVertices( const Mesh& mesh, Strategy strategy, std::vector<int>& order ) const;
+      void orderFaces( const Mesh& mesh, Strategy strategy, std::vector<int>& order ) const;
+      void orderGraph( const Mesh& mesh, bool reverseCuthillMcKee, std::vector<int>& order ) const;
+      // old positions of the elements, listed in the new order
+   };
+}
+
+#endif
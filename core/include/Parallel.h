@@ -0,0 +1,79 @@
+// -----------------------------------------------------------------------------
+// libDDG -- Parallel.h
+// -----------------------------------------------------------------------------
+//
+// parallelFor() splits a range of indices into contiguous blocks and processes
+// the blocks on separate threads.  It is meant for loops over mesh elements
+// whose iterations are independent, e.g.,
+//
+//    parallelFor( 0, mesh.faces.size(), [&]( int begin, int end )
+//    {
+//       for( int i = begin; i < end; i++ )
+//       {
+//          // ... only write to entry i ...
+//       }
+//    });
+//
+// Small ranges (fewer than "grain" indices per thread) are processed on the
+// calling thread.  The number of threads defaults to the number of hardware
+// threads and can be limited via the environment variable DDG_NUM_THREADS.
+//
+
+#ifndef DDG_PARALLEL_H
+#define DDG_PARALLEL_H
+
+#include <algorithm>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+namespace DDG
+{
+   inline int parallelThreads( void )
+   // returns the maximum number of threads used by parallelFor
+   {
+      static const int nThreads = []
+      {
+         const char* s = std::getenv( "DDG_NUM_THREADS" );
+         int n = s ? std::atoi( s ) : 0;
+         if( n <= 0 ) n = std::thread::hardware_concurrency();
+         return std::max( n, 1 );
+      }();
+
+      return nThreads;
+   }
+
+   template <class Body>
+   void parallelFor( int begin, int end, const Body& body, int grain = 1024 )
+   // calls body( b, e ) on disjoint subranges [b,e) covering [begin,end)
+   {
+      int n = end - begin;
+      if( n <= 0 ) return;
+
+      int nThreads = std::min( parallelThreads(), ( n + grain - 1 ) / grain );
+      if( nThreads <= 1 )
+      {
+         body( begin, end );
+         return;
+      }
+
+      // the calling thread takes the last block
+      std::vector<std::thread> threads;
+      threads.reserve( nThreads-1 );
+      for( int t = 0; t < nThreads-1; t++ )
+      {
+         int b = begin + (long) n *  t    / nThreads;
+         int e = begin + (long) n * (t+1) / nThreads;
+         threads.push_back( std::thread( [&body,b,e]{ body( b, e ); } ));
+      }
+      body( begin + (long) n * (nThreads-1) / nThreads, end );
+
+      for( size_t t = 0; t < threads.size(); t++ )
+      {
+         threads[t].join();
+      }
+   }
+}
+
+#endif
+
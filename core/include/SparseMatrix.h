@@ -175,7 +175,16 @@ namespace DDG
          ~SparseFactor( void );
 
          void build( SparseMatrix<T>& A );
-         // factorizes positive-definite matrix A using CHOLMOD
+         // factorizes positive-definite matrix A using CHOLMOD; the
+         // factorization variant and ordering are taken from the
+         // LinearContext of the calling thread
+
+         bool refactor( SparseMatrix<T>& A );
+         // recomputes the numerical factorization for new values of A,
+         // reusing the ordering and symbolic analysis of the last call to
+         // build(); A must have the same nonzero pattern as before (if its
+         // size differs, build() is called instead).  Returns false if A
+         // turned out not to be positive definite or CHOLMOD failed
 
          bool valid( void ) const;
          // returns true if the factor has been built; false otherwise
@@ -185,6 +194,10 @@ namespace DDG
 
       protected:
          cholmod_factor *L;
+
+         SparseFactor( const SparseFactor<T>& );
+         const SparseFactor<T>& operator=( const SparseFactor<T>& );
+         // factors own CHOLMOD memory and cannot be copied
    };
 
    template <class T>
@@ -0,0 +1,137 @@
+// -----------------------------------------------------------------------------
+// libDDG -- Telemetry.h
+// -----------------------------------------------------------------------------
+//
+// Telemetry is a thread-safe registry of named measurements taken by the
+// solvers (and by anyone else who cares to record something).  Each name
+// accumulates a running summary -- number of samples, total, minimum, maximum
+// and most recent value -- so the same interface serves for timers, counters
+// and residuals alike.  Names follow a "solver.quantity" convention, e.g.,
+//
+//    chol.analyze       wall-clock seconds spent in symbolic analysis
+//    chol.factorize     wall-clock seconds spent in numeric factorization
+//    chol.solve         wall-clock seconds spent in triangular solves
+//    chol.nnzL          number of nonzeros in the Cholesky factor
+//    chol.flops         floating-point operations of the factorization
+//    chol.residual      relative residual of the solution
+//    eig.iterations     inverse iterations performed
+//
+// A single global instance is declared in Telemetry.cpp and used by all
+// solvers.  Measurements are always recorded; human-readable progress lines
+// are printed to stdout only when the registry is not in quiet mode:
+//
+//    extern Telemetry telemetry;
+//    telemetry.setQuiet( true );
+//    // ... run solvers ...
+//    telemetry.writeJSON( "solver.json" );
+//
+// Time intervals are measured with Timer, which reads a monotonic wall clock
+// (unlike clock(), which measures CPU time of the whole process).
+//
+
+#ifndef DDG_TELEMETRY_H
+#define DDG_TELEMETRY_H
+
+#include <chrono>
+#include <iosfwd>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace DDG
+{
+   class Timer
+   {
+      public:
+         Timer( void );
+         // starts the timer
+
+         void start( void );
+         // restarts the timer
+
+         double elapsed( void ) const;
+         // returns wall-clock seconds since the timer was (re)started
+
+      protected:
+         std::chrono::steady_clock::time_point t0;
+   };
+
+   class Telemetry
+   {
+      public:
+         struct Statistic
+         {
+            Statistic( void );
+
+            void add( double value );
+            // includes value in the summary
+
+            long count;
+            double total;
+            double min;
+            double max;
+            double last;
+         };
+
+         Telemetry( void );
+         // constructor
+
+         void record( const std::string& name, double value );
+         // adds a sample to the named statistic
+
+         void clear( void );
+         // discards all statistics
+
+         bool has( const std::string& name ) const;
+         // returns true if at least one sample was recorded under name
+
+         Statistic get( const std::string& name ) const;
+         // returns a copy of the named statistic (empty if never recorded)
+
+         void setQuiet( bool quiet );
+         // enables or disables quiet mode
+
+         bool quiet( void ) const;
+         // returns true if solvers should not print progress
+
+         void print( const std::string& tag, const std::string& label, double value, const char* unit = "" ) const;
+         // prints "[tag] label: value unit" to stdout unless in quiet mode
+
+         void writeJSON( std::ostream& out ) const;
+         void writeCSV( std::ostream& out ) const;
+         // writes all statistics in a machine-readable format
+
+         int writeJSON( const std::string& filename ) const;
+         int writeCSV( const std::string& filename ) const;
+         // writes all statistics to disk; return value is nonzero
+         // only if there was an error
+
+      protected:
+         typedef std::map<std::string,Statistic> StatisticMap;
+
+         StatisticMap statistics;
+         bool isQuiet;
+         mutable std::mutex mutex;
+   };
+
+   class ScopedTimer
+   {
+      public:
+         ScopedTimer( Telemetry& telemetry, const std::string& name );
+         // starts timing
+
+         ~ScopedTimer( void );
+         // records the elapsed wall-clock time under name
+
+         double elapsed( void ) const;
+         // returns seconds elapsed so far
+
+      protected:
+         Telemetry& telemetry;
+         std::string name;
+         Timer timer;
+   };
+}
+
+#endif
+
@@ -0,0 +1,109 @@
+// -----------------------------------------------------------------------------
+// libDDG -- TermList.h
+// -----------------------------------------------------------------------------
+//
+// TermList stores the linear terms of a LinearPolynomial as a flat array of
+// (variable, coefficient) pairs, kept sorted by variable address.  The first
+// few terms live in a small buffer inside the object itself, so polynomials
+// with typical stencil sizes (e.g., a vertex and its one-ring) never touch the
+// heap.  Longer polynomials spill over into a single heap block that grows
+// geometrically.
+//
+// Iteration works just like iteration over the std::map this class replaces:
+//
+//    for( TermCIter t = terms.begin(); t != terms.end(); t++ )
+//    {
+//       Variable* v = t->first;
+//       double    c = t->second;
+//    }
+//
+// Sums of polynomials are computed by a linear-time merge of the two sorted
+// arrays, which is performed in place whenever the current capacity suffices.
+//
+
+#ifndef DDG_TERMLIST_H
+#define DDG_TERMLIST_H
+
+#include <utility>
+#include "Types.h"
+
+namespace DDG
+{
+   class TermList
+   {
+      public:
+         typedef std::pair<Variable*,double> Term;
+         typedef Term*       iterator;
+         typedef const Term* const_iterator;
+         // convenience types for accessing terms
+
+         enum { inlineCapacity = 8 };
+         // number of terms stored without any heap allocation
+
+         TermList( void );
+         // constructs an empty list
+
+         TermList( const TermList& B );
+         // copy constructor
+
+         TermList( TermList&& B ) noexcept;
+         // move constructor -- steals the heap block of B (if any)
+
+         ~TermList( void );
+         // destructor
+
+         TermList& operator=( const TermList& B );
+         // copies B
+
+         TermList& operator=( TermList&& B ) noexcept;
+         // moves B into this list
+
+               iterator begin( void );
+         const_iterator begin( void ) const;
+               iterator   end( void );
+         const_iterator   end( void ) const;
+         // return iterators to the first and one-past-last terms
+
+         int size( void ) const;
+         // returns the number of terms
+
+         bool empty( void ) const;
+         // returns true if there are no terms
+
+         void clear( void );
+         // removes all terms (capacity is retained)
+
+         void reserve( int n );
+         // makes room for at least n terms
+
+         iterator find( Variable* v );
+         const_iterator find( Variable* v ) const;
+         // returns the term for variable v, or end() if v does not appear
+
+         double& operator[]( Variable* v );
+         // returns the coefficient of v, inserting a zero term if necessary
+
+         void push_back( Variable* v, double c );
+         // appends a term; v must be greater than every variable already in
+         // the list (i.e., the caller is responsible for preserving the order)
+
+         void accumulate( const TermList& B, double s );
+         // adds s times the terms of B to this list
+
+         void swap( TermList& B );
+         // exchanges the contents of two lists
+
+      protected:
+         Term* terms;
+         int nTerms;
+         int capacity;
+         Term local[ inlineCapacity ];
+
+         bool isLocal( void ) const;
+         void grow( int n );
+         iterator lowerBound( Variable* v ) const;
+   };
+}
+
+#endif
+
@@ -11,6 +11,7 @@
 
 #include <cholmod.h>
 #include <map>
+#include <utility>
 #include <vector>
 
 namespace DDG
@@ -31,6 +32,7 @@ namespace DDG
    class Quaternion;
    class Real;
    class Shader;
+   class TermList;
    class Variable;
    class Vector;
    class Vertex;
@@ -43,8 +45,8 @@ namespace DDG
    class SparseMatrix;
    
    // convenience types for iterators
-   typedef std::map<Variable*,double>::iterator            TermIter;
-   typedef std::map<Variable*,double>::const_iterator     TermCIter;
+   typedef std::pair<Variable*,double>*                    TermIter;
+   typedef const std::pair<Variable*,double>*             TermCIter;
    typedef std::vector<LinearPolynomial>::iterator         PolyIter;
    typedef std::vector<LinearPolynomial>::const_iterator  PolyCIter;
    typedef std::vector<LinearEquation>::iterator            EqnIter;
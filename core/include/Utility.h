@@ -2,6 +2,7 @@
 #define DDG_UTILITY_H
 
 #include <cstdlib>
+#include <ctime>
 #include "Utility.h"
 #include "Complex.h"
 
@@ -19,7 +20,9 @@ namespace DDG
       return rRandMax * (double) rand();
    }
 
-   inline double seconds( int t0, int t1 )
+   inline double seconds( clock_t t0, clock_t t1 )
+   // returns CPU seconds between two calls to clock(); use Timer
+   // (see Telemetry.h) to measure wall-clock time instead
    {
       return (double)(t1-t0) / (double) CLOCKS_PER_SEC;
    }
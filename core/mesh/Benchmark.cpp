@@ -0,0 +1,374 @@
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+using namespace std;
+
+#include "Benchmark.h"
+#include "MeshGenerator.h"
+#include "Mesh.h"
+#include "Real.h"
+#include "DenseMatrix.h"
+#include "SparseMatrix.h"
+#include "DiscreteExteriorCalculus.h"
+#include "Telemetry.h"
+
+namespace DDG
+{
+   extern Telemetry telemetry;
+
+   namespace
+   {
+      string faceLabel( int nFaces )
+      // 1000 -> "1k", 2000000 -> "2m", 1500 -> "1500"
+      {
+         stringstream ss;
+         if     ( nFaces >= 1000000 && nFaces % 1000000 == 0 ) ss << nFaces/1000000 << "m";
+         else if( nFaces >=    1000 && nFaces %    1000 == 0 ) ss << nFaces/1000    << "k";
+         else ss << nFaces;
+         return ss.str();
+      }
+   }
+
+   Benchmark :: Benchmark( const CommandLine& args_ )
+   : args( args_ ),
+     nRepeat( max( 1, args_.value( "repeat", 3 ))),
+     genus( max( 1, args_.value( "genus", 2 )))
+   {
+      vector<string> shapes = args.list( "shapes" );
+      if( shapes.empty() )
+      {
+         shapes.push_back( "sphere" );
+         shapes.push_back( "torus" );
+         shapes.push_back( "disc" );
+         shapes.push_back( "scan" );
+      }
+
+      vector<int> faces = args.indices( "faces" );
+      if( faces.empty() )
+      {
+         faces.push_back( 1000 );
+         faces.push_back( 10000 );
+         faces.push_back( 100000 );
+      }
+
+      vector<MeshOrdering::Strategy> orders;
+      vector<string> orderNames = args.list( "orders" );
+      for( size_t o = 0; o < orderNames.size(); o++ )
+      {
+         MeshOrdering::Strategy order;
+         if( !MeshOrdering::parse( orderNames[o], order ))
+         {
+            cerr << "Warning: ignoring unknown order " << orderNames[o] << endl;
+            continue;
+         }
+         orders.push_back( order );
+      }
+      if( orders.empty() )
+      {
+         orders.push_back( MeshOrdering::inputOrder );
+      }
+
+      for( size_t s = 0; s < shapes.size(); s++ )
+      {
+         if( shapes[s] != "sphere" && shapes[s] != "torus" &&
+             shapes[s] != "disc"   && shapes[s] != "scan" )
+         {
+            cerr << "Warning: ignoring unknown shape " << shapes[s] << endl;
+            continue;
+         }
+
+         for( size_t f = 0; f < faces.size(); f++ )
+         for( size_t o = 0; o < orders.size(); o++ )
+         {
+            Case c;
+            c.shape = shapes[s];
+            c.name = shapes[s] + "-" + faceLabel( faces[f] );
+            if( orders[o] != MeshOrdering::inputOrder )
+            {
+               c.name += "-" + MeshOrdering::name( orders[o] );
+            }
+            c.nFaces = faces[f];
+            c.order = orders[o];
+            cases.push_back( c );
+         }
+      }
+
+      // solvers only report progress with --verbose
+      telemetry.setQuiet( !args.has( "verbose" ));
+   }
+
+   Benchmark :: ~Benchmark( void )
+   {
+      if( !filename.empty() && !args.has( "keep" )) remove( filename.c_str() );
+   }
+
+   int Benchmark :: nCases( void ) const
+   {
+      return cases.size();
+   }
+
+   const string& Benchmark :: name( int i ) const
+   {
+      return cases[i].name;
+   }
+
+   const string& Benchmark :: shape( int i ) const
+   {
+      return cases[i].shape;
+   }
+
+   bool Benchmark :: hasBoundary( int i ) const
+   {
+      return cases[i].shape == "disc";
+   }
+
+   int Benchmark :: repeat( void ) const
+   {
+      return nRepeat;
+   }
+
+   void Benchmark :: generate( const Case& c, ostream& out ) const
+   {
+      if( c.shape == "sphere" )
+      {
+         MeshGenerator::sphere( out, MeshGenerator::sphereResolution( c.nFaces ));
+      }
+      else if( c.shape == "torus" )
+      {
+         MeshGenerator::torus( out, genus, MeshGenerator::torusResolution( c.nFaces, genus ));
+      }
+      else if( c.shape == "disc" )
+      {
+         MeshGenerator::disc( out, MeshGenerator::discResolution( c.nFaces ));
+      }
+      else
+      {
+         MeshGenerator::scan( out, MeshGenerator::sphereResolution( c.nFaces ));
+      }
+   }
+
+   int Benchmark :: load( int i, Mesh& mesh )
+   {
+      const Case& c( cases[i] );
+      if( !filename.empty() && !args.has( "keep" )) remove( filename.c_str() );
+      filename = args.value( "dir", "." ) + "/" + c.name + ".obj";
+
+      Timer timer;
+      {
+         ofstream out( filename.c_str() );
+         if( !out.is_open() )
+         {
+            cerr << "Error writing to mesh file " << filename << endl;
+            return 1;
+         }
+         generate( c, out );
+      }
+      telemetry.record( "bench." + c.name + ".generate", timer.elapsed() );
+
+      if( c.order != MeshOrdering::inputOrder )
+      {
+         for( int r = 0; r < nRepeat; r++ )
+         {
+            if( mesh.read( filename )) return 1;
+            timer.start();
+            mesh.reorder( c.order );
+            record( i, "reorder", timer.elapsed() );
+         }
+
+         // all later stages (and mesh.reload()) see the new order
+         if( mesh.write( filename )) return 1;
+      }
+
+      for( int r = 0; r < nRepeat; r++ )
+      {
+         timer.start();
+         if( mesh.read( filename )) return 1;
+         record( i, "load", timer.elapsed() );
+         record( i, "parse", telemetry.get( "mesh.parse" ).last );
+         record( i, "build", telemetry.get( "mesh.build" ).last );
+      }
+
+      cout << c.name << ": " << mesh.vertices.size() << " vertices, "
+                             << mesh.faces.size() << " faces" << endl;
+      return 0;
+   }
+
+   const string& Benchmark :: meshFile( void ) const
+   {
+      return filename;
+   }
+
+   void Benchmark :: runCore( int i, Mesh& mesh )
+   {
+      for( int r = 0; r < nRepeat; r++ )
+      {
+         Timer timer;
+         mesh.invalidateConnectivity();
+         mesh.adjacency();
+         record( i, "adjacency", timer.elapsed() );
+
+         timer.start();
+         mesh.geometry();
+         record( i, "geometry", timer.elapsed() );
+
+         timer.start();
+         SparseMatrix<Real> star0, star1, d0, L;
+         HodgeStar0Form<Real>::build( mesh, star0 );
+         HodgeStar1Form<Real>::build( mesh, star1 );
+         ExteriorDerivative0Form<Real>::build( mesh, d0 );
+         L = d0.transpose() * star1 * d0;
+         record( i, "dec", timer.elapsed() );
+
+         DenseMatrix<Real> x( L.nRows() ), y;
+         x.randomize();
+         const int nProducts = 10;
+         timer.start();
+         for( int k = 0; k < nProducts; k++ )
+         {
+            y = L * x;
+         }
+         record( i, "multiply", timer.elapsed() / nProducts );
+
+         SparseMatrix<Real> A = L + Real( 1e-8 ) * star0;
+         SparseFactor<Real> factor;
+         timer.start();
+         factor.build( A );
+         record( i, "factorize", timer.elapsed() );
+
+         timer.start();
+         factor.refactor( A );
+         record( i, "refactor", timer.elapsed() );
+
+         DenseMatrix<Real> b = star0 * x;
+         timer.start();
+         backsolvePositiveDefinite( factor, y, b );
+         record( i, "backsolve", timer.elapsed() );
+
+         timer.start();
+         smallestEigPositiveDefinite( A, star0, x );
+         record( i, "eigen", timer.elapsed() );
+      }
+   }
+
+   void Benchmark :: record( int i, const string& stage, double seconds )
+   {
+      if( find( stages.begin(), stages.end(), stage ) == stages.end() )
+      {
+         stages.push_back( stage );
+      }
+
+      telemetry.record( "bench." + cases[i].name + "." + stage, seconds );
+   }
+
+   int Benchmark :: finish( void ) const
+   {
+      // fastest repetition of each stage, in milliseconds
+      size_t width = 16;
+      for( size_t i = 0; i < cases.size(); i++ ) width = max( width, cases[i].name.size() + 2 );
+      cout << endl << setw( width ) << left << "case" << right;
+      for( size_t s = 0; s < stages.size(); s++ ) cout << setw( 11 ) << stages[s];
+      cout << endl;
+      for( size_t i = 0; i < cases.size(); i++ )
+      {
+         cout << setw( width ) << left << cases[i].name << right;
+         for( size_t s = 0; s < stages.size(); s++ )
+         {
+            string key = "bench." + cases[i].name + "." + stages[s];
+            if( telemetry.has( key ))
+            {
+               cout << setw( 11 ) << fixed << setprecision( 3 )
+                    << 1000. * telemetry.get( key ).min;
+            }
+            else
+            {
+               cout << setw( 11 ) << "-";
+            }
+         }
+         cout << endl;
+      }
+      cout << "(milliseconds, fastest of " << nRepeat << ")" << endl;
+      cout.unsetf( ios::floatfield );
+
+      int rval = args.writeTelemetry();
+
+      if( args.has( "baseline" ))
+      {
+         rval |= writeBaseline( args.value( "baseline", "thresholds.txt" ),
+                                args.value( "margin", .5 ));
+      }
+
+      if( args.has( "thresholds" ))
+      {
+         rval |= checkThresholds( args.value( "thresholds", "thresholds.txt" ));
+      }
+
+      return rval;
+   }
+
+   int Benchmark :: writeBaseline( const string& filename, double margin ) const
+   {
+      ofstream out( filename.c_str() );
+
+      if( !out.is_open() )
+      {
+         cerr << "Error writing to thresholds file " << filename << endl;
+         return 1;
+      }
+
+      out << "# maximum wall-clock seconds per stage (measured time + "
+          << 100.*margin << "%)" << endl;
+      out << setprecision( 6 );
+      for( size_t i = 0; i < cases.size(); i++ )
+      for( size_t s = 0; s < stages.size(); s++ )
+      {
+         string key = "bench." + cases[i].name + "." + stages[s];
+         if( !telemetry.has( key )) continue;
+         out << key << " " << ( 1. + margin ) * telemetry.get( key ).min << endl;
+      }
+
+      return 0;
+   }
+
+   int Benchmark :: checkThresholds( const string& filename ) const
+   {
+      ifstream in( filename.c_str() );
+
+      if( !in.is_open() )
+      {
+         cerr << "Error reading from thresholds file " << filename << endl;
+         return 1;
+      }
+
+      int nChecked = 0, nFailed = 0;
+      string line;
+      while( getline( in, line ))
+      {
+         line = line.substr( 0, line.find( '#' ));
+         stringstream ss( line );
+         string key;
+         double threshold;
+         if( !( ss >> key >> threshold )) continue;
+
+         // stages of cases that were not run are not checked
+         if( !telemetry.has( key )) continue;
+
+         nChecked++;
+         double seconds = telemetry.get( key ).min;
+         if( seconds > threshold )
+         {
+            cout << "REGRESSION " << key << ": " << seconds
+                 << "s (threshold " << threshold << "s)" << endl;
+            nFailed++;
+         }
+      }
+
+      cout << nChecked - nFailed << " of " << nChecked
+           << " stages within thresholds" << endl;
+
+      return nFailed > 0;
+   }
+}
+
@@ -0,0 +1,91 @@
+#include <vector>
+using namespace std;
+
+#include "MeshAdjacency.h"
+#include "Mesh.h"
+
+namespace DDG
+{
+   void MeshAdjacency :: build( const Mesh& mesh )
+   // collects the one rings of all vertices of mesh
+   {
+      int nV = mesh.vertices.size();
+      const HalfEdge* first = mesh.halfedges.empty() ? NULL : &mesh.halfedges[0];
+
+      // count outgoing halfedges, then lay out the rows
+      offsets.assign( nV+1, 0 );
+      parallelFor( 0, nV, [&]( int b, int e )
+      {
+         for( int i = b; i < e; i++ )
+         {
+            const Vertex& v( mesh.vertices[i] );
+            if( v.isIsolated() ) continue;
+
+            int n = 0;
+            HalfEdgeCIter h = v.he;
+            do
+            {
+               n++;
+               h = h->flip->next;
+            }
+            while( h != v.he );
+            offsets[ v.index+1 ] = n;
+         }
+      });
+      for( int i = 0; i < nV; i++ )
+      {
+         offsets[i+1] += offsets[i];
+      }
+
+      int nEntries = offsets[nV];
+      halfedge.resize( nEntries );
+      flip.resize( nEntries );
+      next.resize( nEntries );
+      neighbor.resize( nEntries );
+      face.resize( nEntries );
+
+      parallelFor( 0, nV, [&]( int b, int e )
+      {
+         for( int i = b; i < e; i++ )
+         {
+            const Vertex& v( mesh.vertices[i] );
+            if( v.isIsolated() ) continue;
+
+            int k = offsets[ v.index ];
+            HalfEdgeCIter h = v.he;
+            do
+            {
+               halfedge[k] = &*h - first;
+               flip[k]     = &*h->flip - first;
+               next[k]     = &*h->next - first;
+               neighbor[k] = h->flip->vertex->index;
+               face[k]     = h->onBoundary ? -1 : h->face->index;
+               k++;
+               h = h->flip->next;
+            }
+            while( h != v.he );
+         }
+      });
+   }
+
+   void MeshAdjacency :: clear( void )
+   // releases all storage
+   {
+      vector<int>().swap( offsets );
+      vector<int>().swap( halfedge );
+      vector<int>().swap( flip );
+      vector<int>().swap( next );
+      vector<int>().swap( neighbor );
+      vector<int>().swap( face );
+   }
+
+   int MeshAdjacency :: nVertices( void ) const
+   {
+      return offsets.empty() ? 0 : offsets.size()-1;
+   }
+
+   int MeshAdjacency :: valence( int i ) const
+   {
+      return offsets[i+1] - offsets[i];
+   }
+}
@@ -0,0 +1,116 @@
+#include <cmath>
+using namespace std;
+
+#include "MeshCurvature.h"
+#include "MeshAdjacency.h"
+#include "MeshGeometry.h"
+#include "Mesh.h"
+
+namespace DDG
+{
+   void MeshCurvature :: build( const Mesh& mesh )
+   // computes all quantities for the current state of mesh
+   {
+      const MeshGeometry& geometry( mesh.geometry() );
+      const MeshAdjacency& adjacency( mesh.adjacency() );
+      int nV = mesh.vertices.size();
+
+      angleDefects.assign( nV, 0. );
+      gaussCurvatures.assign( nV, 0. );
+      meanCurvatureNormals.assign( nV, Vector() );
+      meanCurvatures.assign( nV, 0. );
+      minCurvatures.assign( nV, 0. );
+      maxCurvatures.assign( nV, 0. );
+      minDirections.assign( nV, Vector() );
+      maxDirections.assign( nV, Vector() );
+
+      forEachVertexOneRing( adjacency, [&]( int i, int begin, int end )
+      {
+         if( begin == end ) return; // isolated
+
+         const Vector& p( mesh.vertices[i].position );
+         const Vector& N( geometry.vertexNormals[i] );
+         double A = geometry.vertexAreas[i];
+
+         // tangent frame (a,b), with a along the first edge not parallel
+         // to the normal
+         Vector a;
+         for( int k = begin; k < end and a.norm2() == 0.; k++ )
+         {
+            Vector e = mesh.vertices[ adjacency.neighbor[k] ].position - p;
+            a = e - dot( e, N )*N;
+         }
+         a.normalize();
+         Vector b = cross( N, a );
+
+         double angleSum = 0.;
+         bool onBoundary = false;
+         Vector laplace;
+         double Saa = 0., Sab = 0., Sbb = 0.;
+         for( int k = begin; k < end; k++ )
+         {
+            Vector e = mesh.vertices[ adjacency.neighbor[k] ].position - p;
+            double l = e.norm();
+
+            // tip angle of the face to the left of the edge
+            int fL = adjacency.face[k];
+            if( fL < 0 ) onBoundary = true;
+            else angleSum += geometry.angles[ adjacency.next[k] ];
+
+            // cotan Laplacian
+            double w = .5*( geometry.cotans[ adjacency.halfedge[k] ] +
+                            geometry.cotans[ adjacency.flip[k] ] );
+            laplace += w * e;
+
+            // shape operator; the face to the right of the edge is the
+            // face to the left of the next entry of the ring
+            int fR = adjacency.face[ k+1 == end ? begin : k+1 ];
+            if( fL < 0 or fR < 0 or l == 0. ) continue;
+            const Vector& NL( geometry.faceNormals[fL] );
+            const Vector& NR( geometry.faceNormals[fR] );
+            double beta = atan2( dot( e, cross( NL, NR ))/l, dot( NL, NR ));
+            double c = .5 * beta * l; // half of the edge lies in the dual cell
+            double u = dot( e, a ) / l;
+            double v = dot( e, b ) / l;
+            Saa += c*u*u;
+            Sab += c*u*v;
+            Sbb += c*v*v;
+         }
+
+         angleDefects[i] = ( onBoundary ? M_PI : 2.*M_PI ) - angleSum;
+         if( A <= 0. ) return;
+
+         gaussCurvatures[i] = angleDefects[i] / A;
+         meanCurvatureNormals[i] = -laplace / ( 2.*A );
+         double H = meanCurvatureNormals[i].norm();
+         meanCurvatures[i] = dot( meanCurvatureNormals[i], N ) < 0. ? -H : H;
+
+         // eigenvalues and eigenvectors of the symmetric 2x2 tensor; the
+         // eigenvector of the larger eigenvalue is the direction the
+         // surface bends least in, and vice versa
+         Saa /= A; Sab /= A; Sbb /= A;
+         double mid = .5*( Saa + Sbb );
+         double radius = sqrt( .25*( Saa-Sbb )*( Saa-Sbb ) + Sab*Sab );
+         double phi = .5*atan2( 2.*Sab, Saa-Sbb );
+         Vector u = cos( phi )*a + sin( phi )*b;
+         maxCurvatures[i] = mid + radius;
+         minCurvatures[i] = mid - radius;
+         maxDirections[i] = cross( N, u );
+         minDirections[i] = u;
+      });
+   }
+
+   void MeshCurvature :: clear( void )
+   // releases all storage
+   {
+      vector<double>().swap( angleDefects );
+      vector<double>().swap( gaussCurvatures );
+      vector<Vector>().swap( meanCurvatureNormals );
+      vector<double>().swap( meanCurvatures );
+      vector<double>().swap( minCurvatures );
+      vector<double>().swap( maxCurvatures );
+      vector<Vector>().swap( minDirections );
+      vector<Vector>().swap( maxDirections );
+   }
+}
+
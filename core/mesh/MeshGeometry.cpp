@@ -0,0 +1,197 @@
+#include <cmath>
+using namespace std;
+
+#include "MeshGeometry.h"
+#include "GeometryKernels.h"
+#include "Mesh.h"
+
+namespace DDG
+{
+   MeshGeometry :: MeshGeometry( void )
+   // constructs an empty cache
+   : firstHalfEdge( NULL )
+   {}
+
+   void MeshGeometry :: build( const Mesh& mesh )
+   // computes all quantities for the current state of mesh
+   {
+      int nH = mesh.halfedges.size();
+      int nV = mesh.vertices.size();
+      int nE = mesh.edges.size();
+      int nF = mesh.faces.size();
+
+      firstHalfEdge = nH > 0 ? &mesh.halfedges[0] : NULL;
+
+      cotans.assign( nH, 0. );
+      angles.assign( nH, 0. );
+      edgeLengths.resize( nE );
+      faceAreas.resize( nF );
+      faceNormals.resize( nF );
+      circumcenters.resize( nF );
+      vertexAreas.assign( nV, 0. );
+      vertexNormals.assign( nV, Vector() );
+      if( nF == 0 ) return;
+
+      // copy connectivity and coordinates into flat arrays so that the
+      // kernels can process many elements per instruction
+      x.resize( nV ); y.resize( nV ); z.resize( nV );
+      for( VertexCIter v  = mesh.vertices.begin();
+                       v != mesh.vertices.end();
+                       v ++ )
+      {
+         x[ v->index ] = v->position.x;
+         y[ v->index ] = v->position.y;
+         z[ v->index ] = v->position.z;
+      }
+
+      tail.resize( nE ); head.resize( nE );
+      for( EdgeCIter e  = mesh.edges.begin();
+                     e != mesh.edges.end();
+                     e ++ )
+      {
+         tail[ e->index ] = e->he->vertex->index;
+         head[ e->index ] = e->he->flip->vertex->index;
+      }
+
+      for( int k = 0; k < 3; k++ )
+      {
+         corner[k].resize( nF );
+         cornerCotans[k].resize( nF );
+         faceHalfEdge[k].resize( nF );
+         unitNormal[k].resize( nF );
+      }
+      for( FaceCIter f  = mesh.faces.begin();
+                     f != mesh.faces.end();
+                     f ++ )
+      {
+         HalfEdgeCIter h = f->he;
+         for( int k = 0; k < 3; k++ )
+         {
+            corner[k][ f->index ] = h->vertex->index;
+            faceHalfEdge[k][ f->index ] = index( h );
+            h = h->next;
+         }
+      }
+
+      GeometryKernels::Points points = { &x[0], &y[0], &z[0] };
+      GeometryKernels::Triangles triangles = { nF, &corner[0][0], &corner[1][0], &corner[2][0] };
+      GeometryKernels::TriangleGeometry triangleGeometry =
+      {
+         &unitNormal[0][0], &unitNormal[1][0], &unitNormal[2][0],
+         &faceAreas[0],
+         &cornerCotans[0][0], &cornerCotans[1][0], &cornerCotans[2][0]
+      };
+
+      GeometryKernels::faceGeometry( points, triangles, triangleGeometry );
+      if( nE > 0 )
+      {
+         GeometryKernels::edgeLengths( points, nE, &tail[0], &head[0], &edgeLengths[0] );
+      }
+
+      // scatter per-corner values to halfedges and accumulate per-vertex
+      // values; the angle opposing a halfedge is acot( cotan )
+      for( int i = 0; i < nF; i++ )
+      {
+         Vector N( unitNormal[0][i], unitNormal[1][i], unitNormal[2][i] );
+         faceNormals[i] = N;
+
+         for( int k = 0; k < 3; k++ )
+         {
+            int h = faceHalfEdge[k][i];
+            cotans[h] = cornerCotans[k][i];
+            angles[h] = atan2( 1., cornerCotans[k][i] );
+
+            int j = corner[k][i];
+            vertexAreas[j] += faceAreas[i] / 3.;
+            vertexNormals[j] += N;
+         }
+
+         // circumcenter = midpoint of the first edge, offset toward the
+         // opposite corner by half its length times the opposing cotangent
+         int a = corner[0][i];
+         int b = corner[1][i];
+         Vector p0( x[a], y[a], z[a] );
+         Vector p1( x[b], y[b], z[b] );
+         circumcenters[i] = 0.5*( p0+p1 ) + 0.5*cornerCotans[0][i]*cross( N, p1-p0 );
+      }
+
+      for( int j = 0; j < nV; j++ )
+      {
+         double r = vertexNormals[j].norm();
+         if( r > 0. ) vertexNormals[j] /= r;
+      }
+   }
+
+   void MeshGeometry :: clear( void )
+   // releases all storage
+   {
+      vector<double>().swap( cotans );
+      vector<double>().swap( angles );
+      vector<double>().swap( edgeLengths );
+      vector<double>().swap( faceAreas );
+      vector<Vector>().swap( faceNormals );
+      vector<Vector>().swap( circumcenters );
+      vector<double>().swap( vertexAreas );
+      vector<Vector>().swap( vertexNormals );
+      vector<double>().swap( x );
+      vector<double>().swap( y );
+      vector<double>().swap( z );
+      vector<int>().swap( tail );
+      vector<int>().swap( head );
+      for( int k = 0; k < 3; k++ )
+      {
+         vector<int>().swap( corner[k] );
+         vector<int>().swap( faceHalfEdge[k] );
+         vector<double>().swap( cornerCotans[k] );
+         vector<double>().swap( unitNormal[k] );
+      }
+      firstHalfEdge = NULL;
+   }
+
+   double MeshGeometry :: cotan( HalfEdgeCIter h ) const
+   {
+      return cotans[ index( h ) ];
+   }
+
+   double MeshGeometry :: angle( HalfEdgeCIter h ) const
+   {
+      return angles[ index( h ) ];
+   }
+
+   double MeshGeometry :: length( EdgeCIter e ) const
+   {
+      return edgeLengths[ e->index ];
+   }
+
+   double MeshGeometry :: area( FaceCIter f ) const
+   {
+      return faceAreas[ f->index ];
+   }
+
+   const Vector& MeshGeometry :: normal( FaceCIter f ) const
+   {
+      return faceNormals[ f->index ];
+   }
+
+   const Vector& MeshGeometry :: circumcenter( FaceCIter f ) const
+   {
+      return circumcenters[ f->index ];
+   }
+
+   double MeshGeometry :: area( VertexCIter v ) const
+   {
+      return vertexAreas[ v->index ];
+   }
+
+   const Vector& MeshGeometry :: normal( VertexCIter v ) const
+   {
+      return vertexNormals[ v->index ];
+   }
+
+   int MeshGeometry :: index( HalfEdgeCIter h ) const
+   // returns the position of h in the halfedge arrays
+   {
+      return &*h - firstHalfEdge;
+   }
+}
+
@@ -5,11 +5,14 @@
 
 #include "MeshIO.h"
 #include "Mesh.h"
+#include "Telemetry.h"
 
 using namespace std;
 
 namespace DDG
 {
+   extern Telemetry telemetry;
+
    class Index
    {
       public:
@@ -50,15 +53,19 @@ namespace DDG
    {
       MeshData data;
    
+      Timer timer;
       if( readMeshData( in, data ))
       {
          return 1;
       }
+      telemetry.record( "mesh.parse", timer.elapsed() );
 
+      timer.start();
       if( buildMesh( data, mesh ))
       {
          return 1;
       }
+      telemetry.record( "mesh.build", timer.elapsed() );
 
       return 0;
    }
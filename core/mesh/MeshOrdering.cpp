@@ -0,0 +1,506 @@
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <stdint.h>
+using namespace std;
+
+#include "MeshOrdering.h"
+#include "Mesh.h"
+
+namespace DDG
+{
+   namespace
+   {
+      const int curveBits = 21;
+      // bits per coordinate of space-filling curve keys (3 x 21 = 63 bits)
+
+      template <class T, class Iter>
+      bool contains( const vector<T>& elements, Iter i )
+      // returns true if i points into elements
+      {
+         if( elements.empty() ) return false;
+         const T* p = &*i;
+         return !less<const T*>()( p, &elements[0] ) &&
+                 less<const T*>()( p, &elements[0] + elements.size() );
+      }
+
+      template <class T, class Iter>
+      int position( const vector<T>& elements, Iter i )
+      // returns the position of the element i in elements
+      {
+         return &*i - &elements[0];
+      }
+
+      template <class T>
+      void permute( vector<T>& elements, const vector<int>& newIndex )
+      // moves each element to its new position without reallocating
+      {
+         vector<T> old( elements );
+         for( size_t i = 0; i < old.size(); i++ )
+         {
+            elements[ newIndex[i] ] = old[i];
+         }
+      }
+
+      void invert( const vector<int>& order, vector<int>& newIndex )
+      // turns a list of old positions in the new order into the new
+      // position of each old position
+      {
+         newIndex.resize( order.size() );
+         for( size_t i = 0; i < order.size(); i++ )
+         {
+            newIndex[ order[i] ] = i;
+         }
+      }
+
+      uint64_t spread( uint64_t x )
+      // moves bit k of x to bit 3k
+      {
+         x &= 0x1fffff;
+         x = ( x | x << 32 ) & 0x1f00000000ffffull;
+         x = ( x | x << 16 ) & 0x1f0000ff0000ffull;
+         x = ( x | x <<  8 ) & 0x100f00f00f00f00full;
+         x = ( x | x <<  4 ) & 0x10c30c30c30c30c3ull;
+         x = ( x | x <<  2 ) & 0x1249249249249249ull;
+         return x;
+      }
+
+      uint64_t mortonKey( const unsigned x[3] )
+      // interleaves the bits of the three coordinates
+      {
+         return spread( x[0] ) << 2 | spread( x[1] ) << 1 | spread( x[2] );
+      }
+
+      uint64_t hilbertKey( const unsigned p[3] )
+      // returns the index along a Hilbert curve through the 2^21 x 2^21 x 2^21
+      // grid, using J. Skilling's transform from coordinates to the
+      // "transposed" Hilbert index (AIP Conf. Proc. 707, 2004)
+      {
+         unsigned x[3] = { p[0], p[1], p[2] };
+         const unsigned M = 1u << ( curveBits-1 );
+
+         // inverse undo
+         for( unsigned Q = M; Q > 1; Q >>= 1 )
+         {
+            unsigned P = Q - 1;
+            for( int i = 0; i < 3; i++ )
+            {
+               if( x[i] & Q )
+               {
+                  x[0] ^= P;
+               }
+               else
+               {
+                  unsigned t = ( x[0] ^ x[i] ) & P;
+                  x[0] ^= t;
+                  x[i] ^= t;
+               }
+            }
+         }
+
+         // Gray encode
+         for( int i = 1; i < 3; i++ ) x[i] ^= x[i-1];
+         unsigned t = 0;
+         for( unsigned Q = M; Q > 1; Q >>= 1 )
+         {
+            if( x[2] & Q ) t ^= Q - 1;
+         }
+         for( int i = 0; i < 3; i++ ) x[i] ^= t;
+
+         // the transposed index stores the bits of the index round-robin
+         return mortonKey( x );
+      }
+
+      class CurveKey
+      // maps points in a bounding box to keys along a space-filling curve
+      {
+      public:
+         CurveKey( const Vector& lower, const Vector& upper, bool hilbert )
+         : origin( lower ), useHilbert( hilbert )
+         {
+            Vector extent = upper - lower;
+            double size = max( extent.x, max( extent.y, extent.z ));
+            scale = size > 0. ? ( double( ( 1u << curveBits ) - 1 )) / size : 0.;
+         }
+
+         uint64_t operator()( const Vector& p ) const
+         {
+            unsigned x[3];
+            for( int k = 0; k < 3; k++ )
+            {
+               double s = ( p[k] - origin[k] ) * scale;
+               x[k] = (unsigned) max( 0., min( s, double( ( 1u << curveBits ) - 1 )));
+            }
+            return useHilbert ? hilbertKey( x ) : mortonKey( x );
+         }
+
+      protected:
+         Vector origin;
+         double scale;
+         bool useHilbert;
+      };
+
+      CurveKey curveKey( const Mesh& mesh, bool hilbert )
+      // returns the curve through the bounding box of mesh
+      {
+         double inf = numeric_limits<double>::infinity();
+         Vector lower( inf, inf, inf ), upper( -inf, -inf, -inf );
+         for( VertexCIter v = mesh.vertices.begin(); v != mesh.vertices.end(); v++ )
+         {
+            for( int k = 0; k < 3; k++ )
+            {
+               lower[k] = min( lower[k], v->position[k] );
+               upper[k] = max( upper[k], v->position[k] );
+            }
+         }
+         return CurveKey( lower, upper, hilbert );
+      }
+
+      void sortByKey( vector< pair<uint64_t,int> >& keys, vector<int>& order )
+      // lists the second entries in order of the first, breaking ties by the
+      // second (i.e., by input order)
+      {
+         sort( keys.begin(), keys.end() );
+         order.resize( keys.size() );
+         for( size_t i = 0; i < keys.size(); i++ )
+         {
+            order[i] = keys[i].second;
+         }
+      }
+   }
+
+   bool MeshOrdering :: parse( const string& name, Strategy& strategy )
+   // sets strategy to the strategy called name ("input", "morton",
+   // "hilbert", "bfs" or "rcm"); returns false if there is no such strategy
+   {
+      if     ( name == "input"   ) strategy = inputOrder;
+      else if( name == "morton"  ) strategy = morton;
+      else if( name == "hilbert" ) strategy = hilbert;
+      else if( name == "bfs"     ) strategy = breadthFirst;
+      else if( name == "rcm"     ) strategy = reverseCuthillMcKee;
+      else return false;
+      return true;
+   }
+
+   string MeshOrdering :: name( Strategy strategy )
+   // returns the name of strategy as accepted by parse()
+   {
+      switch( strategy )
+      {
+         case morton:              return "morton";
+         case hilbert:             return "hilbert";
+         case breadthFirst:        return "bfs";
+         case reverseCuthillMcKee: return "rcm";
+         default:                  return "input";
+      }
+   }
+
+   void MeshOrdering :: build( const Mesh& mesh, Strategy strategy )
+   // computes the new position of every element of mesh
+   {
+      int nE = mesh.edges.size();
+      int nF = mesh.faces.size();
+      int nH = mesh.halfedges.size();
+
+      vector<int> order;
+      orderVertices( mesh, strategy, order );
+      invert( order, vertexIndex );
+
+      orderFaces( mesh, strategy, order );
+      invert( order, faceIndex );
+
+      // halfedges face by face in the new face order, then boundary loops
+      vector<int> faceOrder( order );
+      vector<bool> placed( nH, false );
+      order.clear();
+      order.reserve( nH );
+      for( int i = 0; i < nF + (int) mesh.boundaries.size(); i++ )
+      {
+         const Face& f( i < nF ? mesh.faces[ faceOrder[i] ] : mesh.boundaries[ i-nF ] );
+         HalfEdgeCIter h = f.he;
+         do
+         {
+            int k = position( mesh.halfedges, h );
+            if( !placed[k] )
+            {
+               order.push_back( k );
+               placed[k] = true;
+            }
+            h = h->next;
+         }
+         while( h != f.he );
+      }
+      for( int k = 0; k < nH; k++ )
+      {
+         if( !placed[k] ) order.push_back( k );
+      }
+      invert( order, halfedgeIndex );
+
+      // edges in the order their halfedges first appear
+      vector<int> halfedgeOrder( order );
+      vector<bool> seen( nE, false );
+      order.clear();
+      order.reserve( nE );
+      for( int i = 0; i < nH; i++ )
+      {
+         int e = position( mesh.edges, mesh.halfedges[ halfedgeOrder[i] ].edge );
+         if( !seen[e] )
+         {
+            order.push_back( e );
+            seen[e] = true;
+         }
+      }
+      for( int e = 0; e < nE; e++ )
+      {
+         if( !seen[e] ) order.push_back( e );
+      }
+      invert( order, edgeIndex );
+   }
+
+   void MeshOrdering :: orderVertices( const Mesh& mesh, Strategy strategy, vector<int>& order ) const
+   // lists the old vertex positions in the new order
+   {
+      int nV = mesh.vertices.size();
+
+      if( strategy == morton || strategy == hilbert )
+      {
+         CurveKey key( curveKey( mesh, strategy == hilbert ));
+         vector< pair<uint64_t,int> > keys( nV );
+         for( int i = 0; i < nV; i++ )
+         {
+            keys[i] = make_pair( key( mesh.vertices[i].position ), i );
+         }
+         sortByKey( keys, order );
+      }
+      else if( strategy == breadthFirst || strategy == reverseCuthillMcKee )
+      {
+         orderGraph( mesh, strategy == reverseCuthillMcKee, order );
+      }
+      else
+      {
+         order.resize( nV );
+         for( int i = 0; i < nV; i++ ) order[i] = i;
+      }
+   }
+
+   void MeshOrdering :: orderFaces( const Mesh& mesh, Strategy strategy, vector<int>& order ) const
+   // lists the old face positions in the new order; vertexIndex must
+   // already be known
+   {
+      int nF = mesh.faces.size();
+      vector< pair<uint64_t,int> > keys( nF );
+
+      if( strategy == morton || strategy == hilbert )
+      {
+         CurveKey key( curveKey( mesh, strategy == hilbert ));
+         for( int i = 0; i < nF; i++ )
+         {
+            Vector c( 0., 0., 0. );
+            int n = 0;
+            HalfEdgeCIter h = mesh.faces[i].he;
+            do
+            {
+               c += h->vertex->position;
+               n++;
+               h = h->next;
+            }
+            while( h != mesh.faces[i].he );
+            keys[i] = make_pair( key( c / (double) n ), i );
+         }
+      }
+      else if( strategy == breadthFirst || strategy == reverseCuthillMcKee )
+      {
+         // a face follows the first of its vertices
+         for( int i = 0; i < nF; i++ )
+         {
+            int first = mesh.vertices.size();
+            HalfEdgeCIter h = mesh.faces[i].he;
+            do
+            {
+               first = min( first, vertexIndex[ position( mesh.vertices, h->vertex ) ] );
+               h = h->next;
+            }
+            while( h != mesh.faces[i].he );
+            keys[i] = make_pair( (uint64_t) first, i );
+         }
+      }
+      else
+      {
+         for( int i = 0; i < nF; i++ ) keys[i] = make_pair( 0, i );
+      }
+
+      sortByKey( keys, order );
+   }
+
+   void MeshOrdering :: orderGraph( const Mesh& mesh, bool reverseCuthillMcKee, vector<int>& order ) const
+   // lists the old vertex positions in breadth-first or reverse Cuthill-McKee
+   // order; each connected component is traversed separately
+   {
+      int nV = mesh.vertices.size();
+
+      // flat adjacency lists
+      vector<int> offset( nV+1, 0 ), neighbors;
+      neighbors.reserve( mesh.halfedges.size() );
+      for( int i = 0; i < nV; i++ )
+      {
+         const Vertex& v( mesh.vertices[i] );
+         if( !v.isIsolated() )
+         {
+            HalfEdgeCIter h = v.he;
+            do
+            {
+               neighbors.push_back( position( mesh.vertices, h->flip->vertex ));
+               h = h->flip->next;
+            }
+            while( h != v.he );
+         }
+         offset[i+1] = neighbors.size();
+      }
+
+      // Cuthill-McKee visits neighbors in order of increasing degree
+      if( reverseCuthillMcKee )
+      {
+         for( int i = 0; i < nV; i++ )
+         {
+            vector<pair<int,int> > byDegree;
+            for( int k = offset[i]; k < offset[i+1]; k++ )
+            {
+               int j = neighbors[k];
+               byDegree.push_back( make_pair( offset[j+1]-offset[j], j ));
+            }
+            sort( byDegree.begin(), byDegree.end() );
+            for( int k = offset[i]; k < offset[i+1]; k++ )
+            {
+               neighbors[k] = byDegree[k-offset[i]].second;
+            }
+         }
+      }
+
+      vector<int> level( nV, -1 );
+      order.clear();
+      order.reserve( nV );
+      for( int seed = 0; seed < nV; seed++ )
+      {
+         if( level[seed] != -1 ) continue;
+
+         int root = seed;
+         if( reverseCuthillMcKee )
+         {
+            // pseudo-peripheral start vertex: repeatedly move to a vertex of
+            // smallest degree in the last level of a breadth-first search,
+            // as long as that increases the depth
+            int depth = -1;
+            vector<int> visited;
+            for( int sweep = 0; sweep < 8; sweep++ )
+            {
+               visited.assign( 1, root );
+               level[root] = 0;
+               for( size_t q = 0; q < visited.size(); q++ )
+               {
+                  int i = visited[q];
+                  for( int k = offset[i]; k < offset[i+1]; k++ )
+                  {
+                     int j = neighbors[k];
+                     if( level[j] == -1 )
+                     {
+                        level[j] = level[i] + 1;
+                        visited.push_back( j );
+                     }
+                  }
+               }
+
+               int last = level[ visited.back() ];
+               int next = visited.back();
+               for( size_t q = 0; q < visited.size(); q++ )
+               {
+                  int i = visited[q];
+                  if( level[i] == last && offset[i+1]-offset[i] < offset[next+1]-offset[next] )
+                  {
+                     next = i;
+                  }
+               }
+               for( size_t q = 0; q < visited.size(); q++ ) level[ visited[q] ] = -1;
+
+               if( last <= depth ) break;
+               depth = last;
+               root = next;
+            }
+         }
+
+         size_t begin = order.size();
+         order.push_back( root );
+         level[root] = 0;
+         for( size_t q = begin; q < order.size(); q++ )
+         {
+            int i = order[q];
+            for( int k = offset[i]; k < offset[i+1]; k++ )
+            {
+               int j = neighbors[k];
+               if( level[j] == -1 )
+               {
+                  level[j] = level[i] + 1;
+                  order.push_back( j );
+               }
+            }
+         }
+      }
+
+      if( reverseCuthillMcKee )
+      {
+         reverse( order.begin(), order.end() );
+      }
+   }
+
+   void MeshOrdering :: apply( Mesh& mesh ) const
+   // moves every element of mesh to its new position and updates the
+   // iterators stored in mesh elements
+   {
+      permute( mesh.halfedges, halfedgeIndex );
+      permute( mesh.vertices,  vertexIndex   );
+      permute( mesh.edges,     edgeIndex     );
+      permute( mesh.faces,     faceIndex     );
+
+      for( HalfEdgeIter h = mesh.halfedges.begin(); h != mesh.halfedges.end(); h++ )
+      {
+         h->next   = map( mesh, h->next   );
+         h->flip   = map( mesh, h->flip   );
+         h->vertex = map( mesh, h->vertex );
+         h->edge   = map( mesh, h->edge   );
+         h->face   = map( mesh, h->face   );
+      }
+
+      for( VertexIter v = mesh.vertices.begin(); v != mesh.vertices.end(); v++ )
+      {
+         if( !v->isIsolated() ) v->he = map( mesh, v->he );
+      }
+      for( EdgeIter e = mesh.edges.begin();      e != mesh.edges.end();      e++ ) e->he = map( mesh, e->he );
+      for( FaceIter f = mesh.faces.begin();      f != mesh.faces.end();      f++ ) f->he = map( mesh, f->he );
+      for( FaceIter f = mesh.boundaries.begin(); f != mesh.boundaries.end(); f++ ) f->he = map( mesh, f->he );
+   }
+
+   HalfEdgeIter MeshOrdering :: map( Mesh& mesh, HalfEdgeIter h ) const
+   // returns the new position of a halfedge given its old position
+   {
+      return mesh.halfedges.begin() + halfedgeIndex[ position( mesh.halfedges, h ) ];
+   }
+
+   VertexIter MeshOrdering :: map( Mesh& mesh, VertexIter v ) const
+   // returns the new position of a vertex given its old position
+   {
+      return mesh.vertices.begin() + vertexIndex[ position( mesh.vertices, v ) ];
+   }
+
+   EdgeIter MeshOrdering :: map( Mesh& mesh, EdgeIter e ) const
+   // returns the new position of an edge given its old position
+   {
+      return mesh.edges.begin() + edgeIndex[ position( mesh.edges, e ) ];
+   }
+
+   FaceIter MeshOrdering :: map( Mesh& mesh, FaceIter f ) const
+   // returns the new position of a face given its old position; boundary
+   // loops keep their position
+   {
+      if( !contains( mesh.faces, f )) return f;
+      return mesh.faces.begin() + faceIndex[ position( mesh.faces, f ) ];
+   }
+}
@@ -0,0 +1,149 @@
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+using namespace std;
+
+#include "CommandLine.h"
+#include "Telemetry.h"
+
+namespace DDG
+{
+   extern Telemetry telemetry;
+
+   CommandLine :: CommandLine( int argc, char** argv )
+   // parses the arguments of main()
+   : programName( argc > 0 ? argv[0] : "" )
+   {
+      for( int i = 1; i < argc; i++ )
+      {
+         string arg( argv[i] );
+
+         if( arg.size() > 2 && arg.compare( 0, 2, "--" ) == 0 )
+         {
+            size_t eq = arg.find( '=' );
+            if( eq == string::npos )
+            {
+               options[ arg.substr( 2 ) ] = "";
+            }
+            else
+            {
+               options[ arg.substr( 2, eq-2 ) ] = arg.substr( eq+1 );
+            }
+         }
+         else
+         {
+            arguments.push_back( arg );
+         }
+      }
+   }
+
+   const string& CommandLine :: program( void ) const
+   {
+      return programName;
+   }
+
+   int CommandLine :: nPositional( void ) const
+   {
+      return arguments.size();
+   }
+
+   const string& CommandLine :: positional( int i ) const
+   {
+      return arguments[i];
+   }
+
+   bool CommandLine :: has( const string& name ) const
+   {
+      return options.find( name ) != options.end();
+   }
+
+   string CommandLine :: value( const string& name, const char* defaultValue ) const
+   {
+      return value( name, string( defaultValue ));
+   }
+
+   string CommandLine :: value( const string& name, const string& defaultValue ) const
+   {
+      map<string,string>::const_iterator o = options.find( name );
+      if( o == options.end() || o->second.empty() ) return defaultValue;
+      return o->second;
+   }
+
+   double CommandLine :: value( const string& name, double defaultValue ) const
+   {
+      map<string,string>::const_iterator o = options.find( name );
+      if( o == options.end() || o->second.empty() ) return defaultValue;
+      return atof( o->second.c_str() );
+   }
+
+   int CommandLine :: value( const string& name, int defaultValue ) const
+   {
+      map<string,string>::const_iterator o = options.find( name );
+      if( o == options.end() || o->second.empty() ) return defaultValue;
+      return atoi( o->second.c_str() );
+   }
+
+   vector<string> CommandLine :: list( const string& name ) const
+   {
+      vector<string> items;
+
+      stringstream ss( value( name, "" ));
+      string item;
+      while( getline( ss, item, ',' ))
+      {
+         if( !item.empty() ) items.push_back( item );
+      }
+
+      return items;
+   }
+
+   vector<int> CommandLine :: indices( const string& name ) const
+   {
+      vector<string> items = list( name );
+
+      vector<int> values( items.size() );
+      for( size_t i = 0; i < items.size(); i++ )
+      {
+         values[i] = atoi( items[i].c_str() );
+      }
+
+      return values;
+   }
+
+   int CommandLine :: writeTelemetry( void ) const
+   {
+      string filename = value( "telemetry", "" );
+      if( filename.empty() ) return 0;
+
+      size_t n = filename.size();
+      if( n >= 4 && filename.compare( n-4, 4, ".csv" ) == 0 )
+      {
+         return telemetry.writeCSV( filename );
+      }
+      return telemetry.writeJSON( filename );
+   }
+
+   int CommandLine :: writeValues( const string& filename,
+                                   const vector<double>& values,
+                                   int nColumns )
+   {
+      ofstream out( filename.c_str() );
+
+      if( !out.is_open() )
+      {
+         cerr << "Error writing to file " << filename << endl;
+         return 1;
+      }
+
+      out << setprecision( 17 );
+      for( size_t i = 0; i < values.size(); i++ )
+      {
+         out << values[i] << ( (i+1) % nColumns == 0 ? "\n" : " " );
+      }
+
+      return 0;
+   }
+}
+
@@ -13,7 +13,7 @@ using namespace std;
 
 namespace DDG
 {
-   extern LinearContext context;
+   extern thread_local LinearContext& context;
 
    template <class T>
    DenseMatrix<T> :: DenseMatrix( int m_, int n_ )
@@ -9,15 +9,13 @@ namespace DDG
    // to dual discrete 2-forms
    {
       int nV = mesh.vertices.size();
+      const MeshGeometry& geometry( mesh.geometry() );
 
       star0 = SparseMatrix<T>( nV, nV );
 
-      for( VertexCIter v  = mesh.vertices.begin();
-                       v != mesh.vertices.end();
-                       v ++ )
+      for( int i = 0; i < nV; i++ )
       {
-         int i = v->index;
-         star0( i, i ) = v->area();
+         star0( i, i ) = geometry.vertexAreas[i];
       }
    }
 
@@ -31,13 +29,15 @@ namespace DDG
 
       star1 = SparseMatrix<T>( nE, nE );
 
+      const MeshGeometry& geometry( mesh.geometry() );
+
       for( EdgeCIter e  = mesh.edges.begin();
                      e != mesh.edges.end();
                      e ++ )
       {
          // get the cotangents of the two angles opposite this edge
-         double cotAlpha = e->he->cotan();
-         double cotBeta  = e->he->flip->cotan();
+         double cotAlpha = geometry.cotan( e->he );
+         double cotBeta  = geometry.cotan( e->he->flip );
 
          int i = e->index;
          star1( i, i ) = ( cotAlpha + cotBeta ) / 2.;
@@ -51,15 +51,13 @@ namespace DDG
    // to dual discrete 2-forms
    {
       int nF = mesh.faces.size();
+      const MeshGeometry& geometry( mesh.geometry() );
 
       star2 = SparseMatrix<T>( nF, nF );
 
-      for( FaceCIter f  = mesh.faces.begin();
-                     f != mesh.faces.end();
-                     f ++ )
+      for( int i = 0; i < nF; i++ )
       {
-         int i = f->index;
-         star2( i, i ) = 1. / f->area();
+         star2( i, i ) = 1. / geometry.faceAreas[i];
       }
    }
 
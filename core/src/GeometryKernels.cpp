@@ -0,0 +1,344 @@
+#include <atomic>
+#include <cmath>
+using namespace std;
+
+#include "GeometryKernels.h"
+
+#if ( defined( __GNUC__ ) || defined( __clang__ ) ) && defined( __x86_64__ )
+#define DDG_GEOMETRYKERNELS_X86
+#include <immintrin.h>
+#endif
+
+namespace DDG
+{
+   // -------------------------------------------------------------------------
+   // scalar kernels (also used for the remainder of the vector loops)
+   // -------------------------------------------------------------------------
+
+   static void faceGeometryScalar( const GeometryKernels::Points& p,
+                                   const GeometryKernels::Triangles& t,
+                                   GeometryKernels::TriangleGeometry& g,
+                                   int begin )
+   {
+      for( int f = begin; f < t.size; f++ )
+      {
+         int a = t.i0[f];
+         int b = t.i1[f];
+         int c = t.i2[f];
+
+         // edge vectors u = b-a, v = c-a
+         double ux = p.x[b] - p.x[a], uy = p.y[b] - p.y[a], uz = p.z[b] - p.z[a];
+         double vx = p.x[c] - p.x[a], vy = p.y[c] - p.y[a], vz = p.z[c] - p.z[a];
+
+         double Nx = uy*vz - uz*vy;
+         double Ny = uz*vx - ux*vz;
+         double Nz = ux*vy - uy*vx;
+         double doubleArea = sqrt( Nx*Nx + Ny*Ny + Nz*Nz );
+         double r = 1. / doubleArea;
+
+         double uu = ux*ux + uy*uy + uz*uz;
+         double vv = vx*vx + vy*vy + vz*vz;
+         double uv = ux*vx + uy*vy + uz*vz;
+
+         g.nx[f] = Nx * r;
+         g.ny[f] = Ny * r;
+         g.nz[f] = Nz * r;
+         g.area[f] = .5 * doubleArea;
+         g.cot0[f] = ( vv - uv ) * r;
+         g.cot1[f] = uv * r;
+         g.cot2[f] = ( uu - uv ) * r;
+      }
+   }
+
+   static void edgeLengthsScalar( const GeometryKernels::Points& p,
+                                  int size,
+                                  const int* i0,
+                                  const int* i1,
+                                  double* length,
+                                  int begin )
+   {
+      for( int e = begin; e < size; e++ )
+      {
+         double dx = p.x[ i1[e] ] - p.x[ i0[e] ];
+         double dy = p.y[ i1[e] ] - p.y[ i0[e] ];
+         double dz = p.z[ i1[e] ] - p.z[ i0[e] ];
+
+         length[e] = sqrt( dx*dx + dy*dy + dz*dz );
+      }
+   }
+
+#ifdef DDG_GEOMETRYKERNELS_X86
+   // -------------------------------------------------------------------------
+   // AVX2 kernels (four elements per iteration)
+   // -------------------------------------------------------------------------
+
+   // gathers (and AVX-512 square roots) use the masked forms with an explicit
+   // zero source, since the unmasked intrinsics trip -Wmaybe-uninitialized in
+   // some GCC versions
+
+   __attribute__(( target( "avx2,fma" ) ))
+   static inline __m256d gather4( const double* base, __m128i index )
+   {
+      const __m256d all = _mm256_castsi256_pd( _mm256_set1_epi64x( -1 ));
+      return _mm256_mask_i32gather_pd( _mm256_setzero_pd(), base, index, all, 8 );
+   }
+
+   __attribute__(( target( "avx2,fma" ) ))
+   static void faceGeometryAVX2( const GeometryKernels::Points& p,
+                                 const GeometryKernels::Triangles& t,
+                                 GeometryKernels::TriangleGeometry& g )
+   {
+      const __m256d half = _mm256_set1_pd( .5 );
+      const __m256d one  = _mm256_set1_pd( 1. );
+
+      int f = 0;
+      for( ; f + 4 <= t.size; f += 4 )
+      {
+         __m128i a = _mm_loadu_si128( (const __m128i*) ( t.i0 + f ) );
+         __m128i b = _mm_loadu_si128( (const __m128i*) ( t.i1 + f ) );
+         __m128i c = _mm_loadu_si128( (const __m128i*) ( t.i2 + f ) );
+
+         __m256d ax = gather4( p.x, a );
+         __m256d ay = gather4( p.y, a );
+         __m256d az = gather4( p.z, a );
+
+         __m256d ux = _mm256_sub_pd( gather4( p.x, b ), ax );
+         __m256d uy = _mm256_sub_pd( gather4( p.y, b ), ay );
+         __m256d uz = _mm256_sub_pd( gather4( p.z, b ), az );
+         __m256d vx = _mm256_sub_pd( gather4( p.x, c ), ax );
+         __m256d vy = _mm256_sub_pd( gather4( p.y, c ), ay );
+         __m256d vz = _mm256_sub_pd( gather4( p.z, c ), az );
+
+         __m256d Nx = _mm256_fmsub_pd( uy, vz, _mm256_mul_pd( uz, vy ) );
+         __m256d Ny = _mm256_fmsub_pd( uz, vx, _mm256_mul_pd( ux, vz ) );
+         __m256d Nz = _mm256_fmsub_pd( ux, vy, _mm256_mul_pd( uy, vx ) );
+
+         __m256d doubleArea = _mm256_sqrt_pd(
+            _mm256_fmadd_pd( Nx, Nx, _mm256_fmadd_pd( Ny, Ny, _mm256_mul_pd( Nz, Nz ))));
+         __m256d r = _mm256_div_pd( one, doubleArea );
+
+         __m256d uu = _mm256_fmadd_pd( ux, ux, _mm256_fmadd_pd( uy, uy, _mm256_mul_pd( uz, uz )));
+         __m256d vv = _mm256_fmadd_pd( vx, vx, _mm256_fmadd_pd( vy, vy, _mm256_mul_pd( vz, vz )));
+         __m256d uv = _mm256_fmadd_pd( ux, vx, _mm256_fmadd_pd( uy, vy, _mm256_mul_pd( uz, vz )));
+
+         _mm256_storeu_pd( g.nx   + f, _mm256_mul_pd( Nx, r ));
+         _mm256_storeu_pd( g.ny   + f, _mm256_mul_pd( Ny, r ));
+         _mm256_storeu_pd( g.nz   + f, _mm256_mul_pd( Nz, r ));
+         _mm256_storeu_pd( g.area + f, _mm256_mul_pd( doubleArea, half ));
+         _mm256_storeu_pd( g.cot0 + f, _mm256_mul_pd( _mm256_sub_pd( vv, uv ), r ));
+         _mm256_storeu_pd( g.cot1 + f, _mm256_mul_pd( uv, r ));
+         _mm256_storeu_pd( g.cot2 + f, _mm256_mul_pd( _mm256_sub_pd( uu, uv ), r ));
+      }
+
+      faceGeometryScalar( p, t, g, f );
+   }
+
+   __attribute__(( target( "avx2,fma" ) ))
+   static void edgeLengthsAVX2( const GeometryKernels::Points& p,
+                                int size,
+                                const int* i0,
+                                const int* i1,
+                                double* length )
+   {
+      int e = 0;
+      for( ; e + 4 <= size; e += 4 )
+      {
+         __m128i a = _mm_loadu_si128( (const __m128i*) ( i0 + e ) );
+         __m128i b = _mm_loadu_si128( (const __m128i*) ( i1 + e ) );
+
+         __m256d dx = _mm256_sub_pd( gather4( p.x, b ), gather4( p.x, a ));
+         __m256d dy = _mm256_sub_pd( gather4( p.y, b ), gather4( p.y, a ));
+         __m256d dz = _mm256_sub_pd( gather4( p.z, b ), gather4( p.z, a ));
+
+         _mm256_storeu_pd( length + e, _mm256_sqrt_pd(
+            _mm256_fmadd_pd( dx, dx, _mm256_fmadd_pd( dy, dy, _mm256_mul_pd( dz, dz )))));
+      }
+
+      edgeLengthsScalar( p, size, i0, i1, length, e );
+   }
+
+   // -------------------------------------------------------------------------
+   // AVX-512 kernels (eight elements per iteration)
+   // -------------------------------------------------------------------------
+
+   __attribute__(( target( "avx512f" ) ))
+   static inline __m512d gather8( const double* base, __m256i index )
+   {
+      return _mm512_mask_i32gather_pd( _mm512_setzero_pd(), 0xff, index, base, 8 );
+   }
+
+   __attribute__(( target( "avx512f" ) ))
+   static inline __m512d sqrt8( __m512d x )
+   {
+      return _mm512_mask_sqrt_pd( _mm512_setzero_pd(), 0xff, x );
+   }
+
+   __attribute__(( target( "avx512f" ) ))
+   static void faceGeometryAVX512( const GeometryKernels::Points& p,
+                                   const GeometryKernels::Triangles& t,
+                                   GeometryKernels::TriangleGeometry& g )
+   {
+      const __m512d half = _mm512_set1_pd( .5 );
+      const __m512d one  = _mm512_set1_pd( 1. );
+
+      int f = 0;
+      for( ; f + 8 <= t.size; f += 8 )
+      {
+         __m256i a = _mm256_loadu_si256( (const __m256i*) ( t.i0 + f ) );
+         __m256i b = _mm256_loadu_si256( (const __m256i*) ( t.i1 + f ) );
+         __m256i c = _mm256_loadu_si256( (const __m256i*) ( t.i2 + f ) );
+
+         __m512d ax = gather8( p.x, a );
+         __m512d ay = gather8( p.y, a );
+         __m512d az = gather8( p.z, a );
+
+         __m512d ux = _mm512_sub_pd( gather8( p.x, b ), ax );
+         __m512d uy = _mm512_sub_pd( gather8( p.y, b ), ay );
+         __m512d uz = _mm512_sub_pd( gather8( p.z, b ), az );
+         __m512d vx = _mm512_sub_pd( gather8( p.x, c ), ax );
+         __m512d vy = _mm512_sub_pd( gather8( p.y, c ), ay );
+         __m512d vz = _mm512_sub_pd( gather8( p.z, c ), az );
+
+         __m512d Nx = _mm512_fmsub_pd( uy, vz, _mm512_mul_pd( uz, vy ) );
+         __m512d Ny = _mm512_fmsub_pd( uz, vx, _mm512_mul_pd( ux, vz ) );
+         __m512d Nz = _mm512_fmsub_pd( ux, vy, _mm512_mul_pd( uy, vx ) );
+
+         __m512d doubleArea = sqrt8(
+            _mm512_fmadd_pd( Nx, Nx, _mm512_fmadd_pd( Ny, Ny, _mm512_mul_pd( Nz, Nz ))));
+         __m512d r = _mm512_div_pd( one, doubleArea );
+
+         __m512d uu = _mm512_fmadd_pd( ux, ux, _mm512_fmadd_pd( uy, uy, _mm512_mul_pd( uz, uz )));
+         __m512d vv = _mm512_fmadd_pd( vx, vx, _mm512_fmadd_pd( vy, vy, _mm512_mul_pd( vz, vz )));
+         __m512d uv = _mm512_fmadd_pd( ux, vx, _mm512_fmadd_pd( uy, vy, _mm512_mul_pd( uz, vz )));
+
+         _mm512_storeu_pd( g.nx   + f, _mm512_mul_pd( Nx, r ));
+         _mm512_storeu_pd( g.ny   + f, _mm512_mul_pd( Ny, r ));
+         _mm512_storeu_pd( g.nz   + f, _mm512_mul_pd( Nz, r ));
+         _mm512_storeu_pd( g.area + f, _mm512_mul_pd( doubleArea, half ));
+         _mm512_storeu_pd( g.cot0 + f, _mm512_mul_pd( _mm512_sub_pd( vv, uv ), r ));
+         _mm512_storeu_pd( g.cot1 + f, _mm512_mul_pd( uv, r ));
+         _mm512_storeu_pd( g.cot2 + f, _mm512_mul_pd( _mm512_sub_pd( uu, uv ), r ));
+      }
+
+      faceGeometryScalar( p, t, g, f );
+   }
+
+   __attribute__(( target( "avx512f" ) ))
+   static void edgeLengthsAVX512( const GeometryKernels::Points& p,
+                                  int size,
+                                  const int* i0,
+                                  const int* i1,
+                                  double* length )
+   {
+      int e = 0;
+      for( ; e + 8 <= size; e += 8 )
+      {
+         __m256i a = _mm256_loadu_si256( (const __m256i*) ( i0 + e ) );
+         __m256i b = _mm256_loadu_si256( (const __m256i*) ( i1 + e ) );
+
+         __m512d dx = _mm512_sub_pd( gather8( p.x, b ), gather8( p.x, a ));
+         __m512d dy = _mm512_sub_pd( gather8( p.y, b ), gather8( p.y, a ));
+         __m512d dz = _mm512_sub_pd( gather8( p.z, b ), gather8( p.z, a ));
+
+         _mm512_storeu_pd( length + e, sqrt8(
+            _mm512_fmadd_pd( dx, dx, _mm512_fmadd_pd( dy, dy, _mm512_mul_pd( dz, dz )))));
+      }
+
+      edgeLengthsScalar( p, size, i0, i1, length, e );
+   }
+#endif
+
+   // -------------------------------------------------------------------------
+   // dispatch
+   // -------------------------------------------------------------------------
+
+   static atomic<int> selectedInstructionSet( -1 );
+
+   static GeometryKernels::InstructionSet bestInstructionSet( void )
+   {
+      if( GeometryKernels::isSupported( GeometryKernels::avx512 )) return GeometryKernels::avx512;
+      if( GeometryKernels::isSupported( GeometryKernels::avx2   )) return GeometryKernels::avx2;
+      return GeometryKernels::scalar;
+   }
+
+   void GeometryKernels :: faceGeometry( const Points& points,
+                                         const Triangles& triangles,
+                                         TriangleGeometry& geometry )
+   // computes normals, areas and cotangents of all triangles
+   {
+      switch( instructionSet() )
+      {
+#ifdef DDG_GEOMETRYKERNELS_X86
+         case avx512: faceGeometryAVX512( points, triangles, geometry ); break;
+         case avx2:   faceGeometryAVX2  ( points, triangles, geometry ); break;
+#endif
+         default:     faceGeometryScalar( points, triangles, geometry, 0 ); break;
+      }
+   }
+
+   void GeometryKernels :: edgeLengths( const Points& points,
+                                        int size,
+                                        const int* i0,
+                                        const int* i1,
+                                        double* length )
+   // computes the distance between points i0[k] and i1[k]
+   {
+      switch( instructionSet() )
+      {
+#ifdef DDG_GEOMETRYKERNELS_X86
+         case avx512: edgeLengthsAVX512( points, size, i0, i1, length ); break;
+         case avx2:   edgeLengthsAVX2  ( points, size, i0, i1, length ); break;
+#endif
+         default:     edgeLengthsScalar( points, size, i0, i1, length, 0 ); break;
+      }
+   }
+
+   GeometryKernels::InstructionSet GeometryKernels :: instructionSet( void )
+   // returns the variant used by the kernels
+   {
+      int set = selectedInstructionSet.load();
+
+      if( set < 0 )
+      {
+         set = bestInstructionSet();
+         selectedInstructionSet.store( set );
+      }
+
+      return InstructionSet( set );
+   }
+
+   void GeometryKernels :: setInstructionSet( InstructionSet set )
+   // overrides the variant; ignored if set is not supported
+   {
+      if( isSupported( set ))
+      {
+         selectedInstructionSet.store( set );
+      }
+   }
+
+   bool GeometryKernels :: isSupported( InstructionSet set )
+   // returns true if set can run on this processor
+   {
+      switch( set )
+      {
+         case scalar: return true;
+#ifdef DDG_GEOMETRYKERNELS_X86
+         case avx2:   return __builtin_cpu_supports( "avx2" ) && __builtin_cpu_supports( "fma" );
+         case avx512: return __builtin_cpu_supports( "avx512f" );
+#endif
+         default:     return false;
+      }
+   }
+
+   const char* GeometryKernels :: name( InstructionSet set )
+   // returns a human-readable name for set
+   {
+      switch( set )
+      {
+         case avx2:   return "avx2";
+         case avx512: return "avx512";
+         default:     return "scalar";
+      }
+   }
+}
+
@@ -0,0 +1,136 @@
+#include <mutex>
+#include <thread>
+using namespace std;
+
+#include "LinearContext.h"
+
+namespace DDG
+{
+   // thread that ran static initialization, i.e., the main thread
+   static const thread::id mainThread = this_thread::get_id();
+
+   static LinearContext& threadContext( void )
+   {
+      // the main thread's thread_local objects are destroyed before its
+      // static ones, but static matrices and factors (e.g., the viewers'
+      // meshes) still free their CHOLMOD memory through this context at
+      // exit -- so the main thread's context is never destroyed.  Calls
+      // made before mainThread is initialized come from static
+      // initialization, which also runs on the main thread.
+      if( mainThread == thread::id() or mainThread == this_thread::get_id() )
+      {
+         static LinearContext* mainContext = new LinearContext;
+         return *mainContext;
+      }
+
+      // contexts of worker threads go away with their threads
+      thread_local LinearContext workerContext;
+      return workerContext;
+   }
+
+   // per-thread context for linear solvers
+   thread_local LinearContext& context = threadContext();
+
+   // options used when a thread first touches its context
+   static mutex sharedDefaultsMutex;
+
+   static LinearContext::Options& sharedDefaults( void )
+   {
+      // constructed on first use, so that contexts created during
+      // static initialization still see valid defaults
+      static LinearContext::Options options;
+      return options;
+   }
+
+   LinearContext::Options :: Options( void )
+   // CHOLMOD defaults
+   : factorization( automatic ),
+     supernodalSwitch( 40. ),
+     ordering( orderingDefault ),
+     nThreads( 0 )
+   {}
+
+   LinearContext :: LinearContext( void )
+   // constructor
+   {
+      cholmod_l_start( &context );
+      setOptions( defaultOptions() );
+   }
+
+   LinearContext :: ~LinearContext( void )
+   // destructor
+   {
+      cholmod_l_finish( &context );
+   }
+
+   LinearContext :: operator cholmod_common*( void )
+   // allows LinearContext to be treated as a cholmod_common*
+   {
+      return &context;
+   }
+
+   void LinearContext :: setOptions( const Options& options )
+   // applies options to this context
+   {
+      currentOptions = options;
+
+      context.supernodal = options.factorization;
+      context.supernodal_switch = options.supernodalSwitch;
+
+      switch( options.ordering )
+      {
+         case orderingAMD:
+            context.nmethods = 1;
+            context.method[0].ordering = CHOLMOD_AMD;
+            context.postorder = true;
+            break;
+         case orderingMETIS:
+            context.nmethods = 1;
+            context.method[0].ordering = CHOLMOD_METIS;
+            context.postorder = true;
+            break;
+         case orderingNESDIS:
+            context.nmethods = 1;
+            context.method[0].ordering = CHOLMOD_NESDIS;
+            context.postorder = true;
+            break;
+         case orderingNatural:
+            context.nmethods = 1;
+            context.method[0].ordering = CHOLMOD_NATURAL;
+            context.postorder = false;
+            break;
+         default:
+            context.nmethods = 0;
+            context.postorder = true;
+            break;
+      }
+
+      context.SPQR_nthreads = options.nThreads;
+#if defined( CHOLMOD_MAIN_VERSION ) && CHOLMOD_MAIN_VERSION >= 4
+      context.nthreads_max = options.nThreads;
+#endif
+   }
+
+   const LinearContext::Options& LinearContext :: options( void ) const
+   // returns the options of this context
+   {
+      return currentOptions;
+   }
+
+   void LinearContext :: setDefaultOptions( const Options& options )
+   // sets the options of contexts constructed from now on
+   {
+      lock_guard<mutex> lock( sharedDefaultsMutex );
+
+      sharedDefaults() = options;
+   }
+
+   LinearContext::Options LinearContext :: defaultOptions( void )
+   // returns the options used by newly constructed contexts
+   {
+      lock_guard<mutex> lock( sharedDefaultsMutex );
+
+      return sharedDefaults();
+   }
+}
+
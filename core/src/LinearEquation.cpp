@@ -0,0 +1,19 @@
+#include <utility>
+
+#include "LinearEquation.h"
+
+namespace DDG
+{
+   LinearEquation operator==( LinearPolynomial lhs,
+                              LinearPolynomial rhs )
+   // constructs a linear equation with the specified left- and right-hand side
+   {
+      LinearEquation eqn;
+
+      eqn.lhs = std::move( lhs );
+      eqn.rhs = std::move( rhs );
+
+      return eqn;
+   }
+}
+
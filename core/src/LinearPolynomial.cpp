@@ -1,4 +1,5 @@
 #include <iostream>
+#include <utility>
 using namespace std;
 
 #include "LinearPolynomial.h"
@@ -11,11 +12,13 @@ namespace DDG
    {}
 
    LinearPolynomial :: LinearPolynomial( double c )
+   : constantTerm( 0. )
    {
       *this = c;
    }
    
    LinearPolynomial :: LinearPolynomial( Variable& v )
+   : constantTerm( 0. )
    {
       *this = v;
    }
@@ -33,7 +36,7 @@ namespace DDG
    {
       linearTerms.clear();
 
-      linearTerms[ &v ] = 1.;
+      linearTerms.push_back( &v, 1. );
 
       constantTerm = 0.;
 
@@ -76,74 +79,50 @@ namespace DDG
 
    void LinearPolynomial::operator+=( Variable& v )
    {
-      LinearPolynomial p( v );
-
-      *this += p;
+      linearTerms[ &v ] += 1.;
    }
 
    void LinearPolynomial::operator-=( Variable& v )
    {
-      LinearPolynomial p( v );
-
-      *this -= p;
+      linearTerms[ &v ] -= 1.;
    }
 
    void LinearPolynomial::operator+=( const LinearPolynomial& e )
    {
-      for( TermCIter i  = e.linearTerms.begin();
-                     i != e.linearTerms.end();
-                     i++ )
-      {
-         TermIter j = linearTerms.find( i->first );
-   
-         if( j != linearTerms.end() )
-         {
-            j->second += i->second;
-         }
-         else
-         {
-            linearTerms[i->first] = i->second;
-         }
-      }
-   
-      constantTerm += e.constantTerm;
+      accumulate( e, 1. );
    }
 
    void LinearPolynomial::operator-=( const LinearPolynomial& e )
    {
-      for( TermCIter i  = e.linearTerms.begin();
-                     i != e.linearTerms.end();
-                     i++ )
-      {
-         TermIter j = linearTerms.find( i->first );
-   
-         if( j != linearTerms.end() )
-         {
-            j->second -= i->second;
-         }
-         else
-         {
-            linearTerms[i->first] = -i->second;
-         }
-      }
-   
-      constantTerm -= e.constantTerm;
+      accumulate( e, -1. );
+   }
+
+   void LinearPolynomial::accumulate( const LinearPolynomial& e, double s )
+   {
+      linearTerms.accumulate( e.linearTerms, s );
+
+      constantTerm += s * e.constantTerm;
    }
    
-   LinearPolynomial LinearPolynomial::operator-( void ) const
+   LinearPolynomial LinearPolynomial::operator-( void ) const&
    {
       LinearPolynomial p = *this;
 
-      for( TermIter i  = p.linearTerms.begin();
-                    i != p.linearTerms.end();
+      return -std::move( p );
+   }
+
+   LinearPolynomial LinearPolynomial::operator-( void ) &&
+   {
+      for( TermIter i  = linearTerms.begin();
+                    i != linearTerms.end();
                     i ++ )
       {
          i->second = -i->second;
       }
 
-      p.constantTerm = -p.constantTerm;
+      constantTerm = -constantTerm;
 
-      return p;
+      return std::move( *this );
    }
 
    double LinearPolynomial::evaluate( void ) const
@@ -163,7 +142,7 @@ namespace DDG
    LinearPolynomial operator+( double c,
                                Variable& v )
    {
-      return c + LinearPolynomial(v);
+      return LinearPolynomial(v) + c;
    }
 
    LinearPolynomial operator+( Variable& v,
@@ -206,130 +185,252 @@ namespace DDG
    LinearPolynomial operator+( Variable& v1,
                                Variable& v2 )
    {
-      return LinearPolynomial(v1) + LinearPolynomial(v2);
+      LinearPolynomial sum( v1 );
+
+      sum += v2;
+
+      return sum;
    }
 
    LinearPolynomial operator-( Variable& v1,
                                Variable& v2 )
    {
-      return LinearPolynomial(v1) - LinearPolynomial(v2);
+      LinearPolynomial difference( v1 );
+
+      difference -= v2;
+
+      return difference;
    }
 
 
    LinearPolynomial operator+( const LinearPolynomial& p,
                                double c )
    {
-      LinearPolynomial sum = p;
-   
-      sum += c;
-   
-      return sum;
+      return LinearPolynomial(p) + c;
    }
    
    LinearPolynomial operator+( double c,
                                const LinearPolynomial& p )
    {
-      LinearPolynomial sum = p;
+      return LinearPolynomial(p) + c;
+   }
    
-      sum += c;
+   LinearPolynomial operator-( const LinearPolynomial& p,
+                               double c )
+   {
+      return LinearPolynomial(p) - c;
+   }
+
+   LinearPolynomial operator-( double c,
+                               const LinearPolynomial& p )
+   {
+      return c - LinearPolynomial(p);
+   }
    
-      return sum;
+   LinearPolynomial operator*( const LinearPolynomial& p,
+                               double c )
+   {
+      return LinearPolynomial(p) * c;
+   }
+
+   LinearPolynomial operator*( double c,
+                               const LinearPolynomial& p )
+   {
+      return LinearPolynomial(p) * c;
    }
    
-   LinearPolynomial operator-( const LinearPolynomial& p,
+   LinearPolynomial operator/( const LinearPolynomial& p,
+                               double c )
+   {
+      return LinearPolynomial(p) / c;
+   }
+
+   LinearPolynomial operator+( LinearPolynomial&& p,
                                double c )
    {
-      LinearPolynomial difference = p;
+      p += c;
    
-      difference -= c;
+      return std::move( p );
+   }
    
-      return difference;
+   LinearPolynomial operator+( double c,
+                               LinearPolynomial&& p )
+   {
+      p += c;
+   
+      return std::move( p );
+   }
+   
+   LinearPolynomial operator-( LinearPolynomial&& p,
+                               double c )
+   {
+      p -= c;
+   
+      return std::move( p );
    }
 
    LinearPolynomial operator-( double c,
-                               const LinearPolynomial& p )
+                               LinearPolynomial&& p )
    {
-      LinearPolynomial difference = -p;
+      LinearPolynomial difference = -std::move( p );
    
       difference += c;
    
       return difference;
    }
    
-   LinearPolynomial operator*( const LinearPolynomial& p,
+   LinearPolynomial operator*( LinearPolynomial&& p,
                                double c )
    {
-      LinearPolynomial product = p;
-   
-      product *= c;
+      p *= c;
    
-      return product;
+      return std::move( p );
    }
 
    LinearPolynomial operator*( double c,
-                               const LinearPolynomial& p )
+                               LinearPolynomial&& p )
    {
-      LinearPolynomial product = p;
-   
-      product *= c;
+      p *= c;
    
-      return product;
+      return std::move( p );
    }
    
-   LinearPolynomial operator/( const LinearPolynomial& p,
+   LinearPolynomial operator/( LinearPolynomial&& p,
                                double c )
    {
-      LinearPolynomial quotient = p;
-
-      quotient /= c;
+      p /= c;
    
-      return quotient;
+      return std::move( p );
    }
 
    LinearPolynomial operator+( const LinearPolynomial& p,
                                Variable& v )
    {
-      return p + LinearPolynomial(v);
+      return LinearPolynomial(p) + v;
    }
 
    LinearPolynomial operator+( Variable& v,
                                const LinearPolynomial& p )
    {
-      return LinearPolynomial(v) + p;
+      return LinearPolynomial(p) + v;
    }
 
    LinearPolynomial operator-( const LinearPolynomial& p,
                                Variable& v )
    {
-      return p - LinearPolynomial(v);
+      return LinearPolynomial(p) - v;
    }
 
    LinearPolynomial operator-( Variable& v,
                                const LinearPolynomial& p )
    {
-      return LinearPolynomial(v) - p;
+      return v - LinearPolynomial(p);
+   }
+
+   LinearPolynomial operator+( LinearPolynomial&& p,
+                               Variable& v )
+   {
+      p += v;
+
+      return std::move( p );
+   }
+
+   LinearPolynomial operator+( Variable& v,
+                               LinearPolynomial&& p )
+   {
+      p += v;
+
+      return std::move( p );
+   }
+
+   LinearPolynomial operator-( LinearPolynomial&& p,
+                               Variable& v )
+   {
+      p -= v;
+
+      return std::move( p );
+   }
+
+   LinearPolynomial operator-( Variable& v,
+                               LinearPolynomial&& p )
+   {
+      LinearPolynomial difference = -std::move( p );
+
+      difference += v;
+
+      return difference;
    }
 
    LinearPolynomial operator+( const LinearPolynomial& p,
                                const LinearPolynomial& q )
    {
-      LinearPolynomial sum = p;
+      return LinearPolynomial(p) + q;
+   }
+   
+   LinearPolynomial operator-( const LinearPolynomial& p,
+                               const LinearPolynomial& q )
+   {
+      return LinearPolynomial(p) - q;
+   }
+
+   LinearPolynomial operator+( LinearPolynomial&& p,
+                               const LinearPolynomial& q )
+   {
+      p += q;
    
-      sum += q;
+      return std::move( p );
+   }
+
+   LinearPolynomial operator+( const LinearPolynomial& p,
+                               LinearPolynomial&& q )
+   {
+      q += p;
    
-      return sum;
+      return std::move( q );
    }
+
+   LinearPolynomial operator+( LinearPolynomial&& p,
+                               LinearPolynomial&& q )
+   {
+      // accumulate the shorter polynomial into the longer one
+      if( p.linearTerms.size() < q.linearTerms.size() )
+      {
+         q += p;
+
+         return std::move( q );
+      }
+
+      p += q;
    
-   LinearPolynomial operator-( const LinearPolynomial& p,
+      return std::move( p );
+   }
+   
+   LinearPolynomial operator-( LinearPolynomial&& p,
                                const LinearPolynomial& q )
    {
-      LinearPolynomial difference = p;
+      p -= q;
    
-      difference -= q;
+      return std::move( p );
+   }
+
+   LinearPolynomial operator-( const LinearPolynomial& p,
+                               LinearPolynomial&& q )
+   {
+      LinearPolynomial difference = -std::move( q );
+
+      difference += p;
    
       return difference;
    }
 
+   LinearPolynomial operator-( LinearPolynomial&& p,
+                               LinearPolynomial&& q )
+   {
+      p -= q;
+   
+      return std::move( p );
+   }
+
    ostream& operator<<( ostream& os, const LinearPolynomial& p )
    {
       for( TermCIter i  = p.linearTerms.begin();
@@ -1,4 +1,5 @@
 #include <map>
+#include <utility>
 using namespace std;
 
 #include <SuiteSparseQR.hpp>
@@ -9,7 +10,7 @@ using namespace std;
 
 namespace DDG
 {
-   extern LinearContext context;
+   extern thread_local LinearContext& context;
 
    void LinearSystem::clear( void )
    // removes all equations from the system
@@ -23,6 +24,12 @@ namespace DDG
       equations.push_back( e );
    }
 
+   void LinearSystem::push_back( LinearEquation&& e )
+   // appends the equation e to the sytem
+   {
+      equations.push_back( std::move( e ) );
+   }
+
    void LinearSystem::solve( void )
    // solves the system and automatically stores the result in the variables
    // for an overdetermined system, computes a least-squares solution
@@ -38,6 +45,7 @@ namespace DDG
    // converts each equation to its polynomial representation
    {
       currentEquations.clear();
+      currentEquations.reserve( equations.size() );
 
       for( EqnIter eqn  = equations.begin();
                    eqn != equations.end();
@@ -46,8 +54,10 @@ namespace DDG
          // move right-hand side to left-hand side
          LinearPolynomial p = eqn->lhs - eqn->rhs;
 
-         // convert fixed variables to constants
+         // convert fixed variables to constants; terms are visited in
+         // sorted order, so free variables can simply be appended to q
          LinearPolynomial q( p.constantTerm );
+         q.linearTerms.reserve( p.linearTerms.size() );
          
          for( TermIter t  = p.linearTerms.begin();
                        t != p.linearTerms.end();
@@ -59,19 +69,19 @@ namespace DDG
             // skip zeros
             if( coefficient == 0. ) continue;
 
-            if( t->first->fixed )
+            if( variable.fixed )
             {
-               q += coefficient * variable.value;
+               q.constantTerm += coefficient * variable.value;
             }
             else
             {
-               q += coefficient * variable;
+               q.linearTerms.push_back( &variable, coefficient );
             }
          }
 
          if( q.linearTerms.size() > 0 )
          {
-            currentEquations.push_back( q );
+            currentEquations.push_back( std::move( q ) );
          }
       }
 
@@ -0,0 +1,327 @@
+#include <algorithm>
+#include <cmath>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+using namespace std;
+
+#include "MeshGenerator.h"
+#include "Vector.h"
+
+namespace DDG
+{
+   namespace
+   {
+      struct Triangle
+      {
+         Triangle( int a, int b, int c ) { v[0] = a; v[1] = b; v[2] = c; }
+         int v[3];
+      };
+
+      class Random
+      // 64-bit linear congruential generator; unlike rand(), its sequence is
+      // the same on every platform
+      {
+      public:
+         Random( unsigned seed ) : state( seed ) { next(); }
+
+         unsigned long long next( void )
+         {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            return state >> 11;
+         }
+
+         double uniform( void )
+         // returns a number in [0,1)
+         {
+            return next() * ( 1. / 9007199254740992. );
+         }
+
+      protected:
+         unsigned long long state;
+      };
+
+      void write( ostream& out,
+                  const vector<Vector>& positions,
+                  const vector<Triangle>& triangles )
+      {
+         streamsize precision = out.precision( 9 );
+         for( size_t i = 0; i < positions.size(); i++ )
+         {
+            const Vector& p( positions[i] );
+            out << "v " << p.x << " " << p.y << " " << p.z << "\n";
+         }
+         for( size_t i = 0; i < triangles.size(); i++ )
+         {
+            const Triangle& t( triangles[i] );
+            out << "f " << t.v[0]+1 << " " << t.v[1]+1 << " " << t.v[2]+1 << "\n";
+         }
+         out.precision( precision );
+      }
+
+      void icosphere( int level,
+                      vector<Vector>& positions,
+                      vector<Triangle>& triangles )
+      {
+         const double t = ( 1. + sqrt( 5. )) / 2.;
+         const double p[12][3] = {
+            { -1.,  t, 0. }, {  1.,  t, 0. }, { -1., -t, 0. }, {  1., -t, 0. },
+            { 0., -1.,  t }, { 0.,  1.,  t }, { 0., -1., -t }, { 0.,  1., -t },
+            {  t, 0., -1. }, {  t, 0.,  1. }, { -t, 0., -1. }, { -t, 0.,  1. } };
+         const int f[20][3] = {
+            { 0, 11,  5 }, { 0,  5,  1 }, {  0,  1,  7 }, {  0,  7, 10 }, { 0, 10, 11 },
+            { 1,  5,  9 }, { 5, 11,  4 }, { 11, 10,  2 }, { 10,  7,  6 }, { 7,  1,  8 },
+            { 3,  9,  4 }, { 3,  4,  2 }, {  3,  2,  6 }, {  3,  6,  8 }, { 3,  8,  9 },
+            { 4,  9,  5 }, { 2,  4, 11 }, {  6,  2, 10 }, {  8,  6,  7 }, { 9,  8,  1 } };
+
+         positions.clear();
+         triangles.clear();
+         for( int i = 0; i < 12; i++ ) positions.push_back( Vector( p[i][0], p[i][1], p[i][2] ).unit() );
+         for( int i = 0; i < 20; i++ ) triangles.push_back( Triangle( f[i][0], f[i][1], f[i][2] ));
+
+         for( int l = 0; l < level; l++ )
+         {
+            // V - E + F = 2 and E = 3F/2, so each level adds F/2 vertices
+            vector<Triangle> coarse;
+            coarse.swap( triangles );
+            triangles.reserve( 4*coarse.size() );
+            positions.reserve( positions.size() + coarse.size()/2 );
+
+            unordered_map<long long,int> midpoint;
+            midpoint.reserve( 3*coarse.size()/2 );
+            const long long n = positions.size();
+
+            for( size_t k = 0; k < coarse.size(); k++ )
+            {
+               int m[3];
+               for( int j = 0; j < 3; j++ )
+               {
+                  int a = coarse[k].v[j];
+                  int b = coarse[k].v[(j+1)%3];
+                  long long key = min( a, b ) * n + max( a, b );
+
+                  unordered_map<long long,int>::const_iterator e = midpoint.find( key );
+                  if( e == midpoint.end() )
+                  {
+                     m[j] = positions.size();
+                     midpoint[ key ] = m[j];
+                     positions.push_back( ( positions[a] + positions[b] ).unit() );
+                  }
+                  else
+                  {
+                     m[j] = e->second;
+                  }
+               }
+
+               const int* v = coarse[k].v;
+               triangles.push_back( Triangle( v[0], m[0], m[2] ));
+               triangles.push_back( Triangle( v[1], m[1], m[0] ));
+               triangles.push_back( Triangle( v[2], m[2], m[1] ));
+               triangles.push_back( Triangle( m[0], m[1], m[2] ));
+            }
+         }
+      }
+   }
+
+   void MeshGenerator :: sphere( ostream& out, int level )
+   {
+      vector<Vector> positions;
+      vector<Triangle> triangles;
+      icosphere( level, positions, triangles );
+      write( out, positions, triangles );
+   }
+
+   void MeshGenerator :: torus( ostream& out, int genus, int n )
+   // the plate [0,genus] x [0,1] minus one square hole per unit square is
+   // sampled on a grid, each cell split into four triangles around its
+   // center; the top and bottom copies of the plate share their boundary
+   // vertices, which closes the surface.  Holes keep at least two cells away
+   // from each other and from the outer boundary, so no edge joins two
+   // boundary vertices through the interior and the surface is manifold
+   {
+      n = max( n, 6 );
+      genus = max( genus, 1 );
+      const int nx = genus*n;
+      const int ny = n;
+      const int a = n/3, b = n - n/3;
+      // cells a..b-1 of each unit square are removed
+
+      vector<bool> cell( nx*ny );
+      for( int j = 0; j < ny; j++ )
+      for( int i = 0; i < nx; i++ )
+      {
+         int u = i%n;
+         cell[ i + nx*j ] = !( a <= u && u < b && a <= j && j < b );
+      }
+
+      // a grid vertex is used if some incident cell is present, and lies on
+      // the boundary if some incident cell is missing
+      vector<int> top( (nx+1)*(ny+1), -1 );
+      vector<int> bottom( (nx+1)*(ny+1), -1 );
+      vector<Vector> positions;
+      const double h = 1./n;
+      for( int j = 0; j <= ny; j++ )
+      for( int i = 0; i <= nx; i++ )
+      {
+         int present = 0;
+         for( int dj = -1; dj <= 0; dj++ )
+         for( int di = -1; di <= 0; di++ )
+         {
+            int ci = i+di, cj = j+dj;
+            if( ci >= 0 && ci < nx && cj >= 0 && cj < ny && cell[ ci + nx*cj ] ) present++;
+         }
+         if( present == 0 ) continue;
+
+         int k = i + (nx+1)*j;
+         double z = present == 4 ? h : 0.;
+         top[k] = positions.size();
+         positions.push_back( Vector( double(i)/n, double(j)/n, z ));
+         if( present == 4 )
+         {
+            bottom[k] = positions.size();
+            positions.push_back( Vector( double(i)/n, double(j)/n, -z ));
+         }
+         else
+         {
+            bottom[k] = top[k];
+         }
+      }
+
+      vector<Triangle> triangles;
+      triangles.reserve( 8*nx*ny );
+      for( int j = 0; j < ny; j++ )
+      for( int i = 0; i < nx; i++ )
+      {
+         if( !cell[ i + nx*j ] ) continue;
+
+         const int corner[4] = { i   + (nx+1)*j,
+                                 i+1 + (nx+1)*j,
+                                 i+1 + (nx+1)*(j+1),
+                                 i   + (nx+1)*(j+1) };
+
+         for( int side = 0; side < 2; side++ )
+         {
+            const vector<int>& layer( side == 0 ? top : bottom );
+
+            Vector center;
+            for( int c = 0; c < 4; c++ ) center += positions[ layer[ corner[c] ]];
+            int m = positions.size();
+            positions.push_back( center / 4. );
+
+            for( int c = 0; c < 4; c++ )
+            {
+               int p = layer[ corner[c] ];
+               int q = layer[ corner[(c+1)%4] ];
+               if( side == 0 ) triangles.push_back( Triangle( m, p, q ));
+               else            triangles.push_back( Triangle( m, q, p ));
+            }
+         }
+      }
+
+      write( out, positions, triangles );
+   }
+
+   void MeshGenerator :: disc( ostream& out, int n )
+   // ring k has 6k vertices at radius k/n; consecutive rings are zipped
+   // together by always advancing along the ring whose next vertex comes
+   // first in angle
+   {
+      n = max( n, 1 );
+
+      vector<Vector> positions;
+      positions.push_back( Vector( 0., 0., 0. ));
+      for( int k = 1; k <= n; k++ )
+      {
+         int m = 6*k;
+         for( int i = 0; i < m; i++ )
+         {
+            double theta = 2.*M_PI*i/m;
+            positions.push_back( Vector( cos(theta), sin(theta), 0. ) * ( double(k)/n ));
+         }
+      }
+
+      vector<Triangle> triangles;
+      triangles.reserve( 6*n*n );
+      int inner0 = 0, ni = 1;
+      for( int k = 1; k <= n; k++ )
+      {
+         int outer0 = inner0 + ni;
+         int no = 6*k;
+
+         int i = 0, o = 0;
+         while( i + o < ni + no )
+         {
+            bool advanceOuter = ( ni == 1 ) || ( i == ni ) ||
+                                ( o < no && (long long)(o+1)*ni <= (long long)(i+1)*no );
+            if( advanceOuter )
+            {
+               triangles.push_back( Triangle( inner0 + i%ni, outer0 + o%no, outer0 + (o+1)%no ));
+               o++;
+               if( ni == 1 && o == no ) break;
+            }
+            else
+            {
+               triangles.push_back( Triangle( inner0 + i%ni, outer0 + o%no, inner0 + (i+1)%ni ));
+               i++;
+            }
+         }
+
+         inner0 = outer0;
+         ni = no;
+      }
+
+      write( out, positions, triangles );
+   }
+
+   void MeshGenerator :: scan( ostream& out, int level, double noise, unsigned seed )
+   {
+      vector<Vector> positions;
+      vector<Triangle> triangles;
+      icosphere( level, positions, triangles );
+
+      Random random( seed );
+      double edgeLength = 1.05146 / pow( 2., level );
+      for( size_t i = 0; i < positions.size(); i++ )
+      {
+         double r = 1. + noise * edgeLength * ( 2.*random.uniform() - 1. );
+         positions[i] *= r;
+      }
+
+      // Fisher-Yates shuffle of the vertex order
+      vector<int> order( positions.size() );
+      for( size_t i = 0; i < order.size(); i++ ) order[i] = i;
+      for( size_t i = order.size()-1; i > 0; i-- )
+      {
+         swap( order[i], order[ random.next() % (i+1) ] );
+      }
+
+      vector<Vector> shuffled( positions.size() );
+      for( size_t i = 0; i < order.size(); i++ ) shuffled[ order[i] ] = positions[i];
+      for( size_t k = 0; k < triangles.size(); k++ )
+      for( int j = 0; j < 3; j++ )
+      {
+         triangles[k].v[j] = order[ triangles[k].v[j] ];
+      }
+
+      write( out, shuffled, triangles );
+   }
+
+   int MeshGenerator :: sphereResolution( int nFaces )
+   {
+      int level = 0;
+      while( 20. * pow( 4., level+.5 ) < nFaces ) level++;
+      return level;
+   }
+
+   int MeshGenerator :: torusResolution( int nFaces, int genus )
+   {
+      genus = max( genus, 1 );
+      return max( 6, (int) floor( sqrt( nFaces / ( 64./9. * genus )) + .5 ));
+   }
+
+   int MeshGenerator :: discResolution( int nFaces )
+   {
+      return max( 1, (int) floor( sqrt( nFaces / 6. ) + .5 ));
+   }
+}
+
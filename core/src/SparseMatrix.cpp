@@ -1,4 +1,5 @@
 #include "SparseMatrix.h"
+#include "Telemetry.h"
 
 namespace DDG
 {
@@ -148,14 +149,17 @@ namespace DDG
                 DenseMatrix<Real>& b )
    // solves the sparse linear system Ax = b using sparse QR factorization
    {
-      int t0 = clock();
+      Timer timer;
       x = SuiteSparseQR<double>( A.to_cholmod(), b.to_cholmod(), context );
-      int t1 = clock();
 
-      cout << "[qr] time: " << seconds( t0, t1 ) << "s" << "\n";
-      cout << "[qr] max residual: " << residual( A, x, b ) << "\n";
-      cout << "[qr] size: " << A.nRows() << " x " << A.nColumns() << "\n";
-      cout << "[qr] rank: " << (*context).SPQR_istat[4] << "\n";
+      int rank = (*context).SPQR_istat[4];
+      telemetry.record( "qr.rank", rank );
+      reportSolve( "qr", timer.elapsed(), residual( A, x, b ) );
+      if( !telemetry.quiet() )
+      {
+         cout << "[qr] size: " << A.nRows() << " x " << A.nColumns() << "\n";
+         cout << "[qr] rank: " << rank << "\n";
+      }
    }
 
    template <>
@@ -164,14 +168,17 @@ namespace DDG
                 DenseMatrix<Complex>& b )
    // solves the sparse linear system Ax = b using sparse QR factorization
    {
-      int t0 = clock();
+      Timer timer;
       x = SuiteSparseQR< complex<double> >( A.to_cholmod(), b.to_cholmod(), context );
-      int t1 = clock();
 
-      cout << "[qr] time: " << seconds( t0, t1 ) << "s" << "\n";
-      cout << "[qr] max residual: " << residual( A, x, b ) << "\n";
-      cout << "[qr] size: " << A.nRows() << " x " << A.nColumns() << " (complex)" << "\n";
-      cout << "[qr] rank: " << (*context).SPQR_istat[4] << "\n";
+      int rank = (*context).SPQR_istat[4];
+      telemetry.record( "qr.rank", rank );
+      reportSolve( "qr", timer.elapsed(), residual( A, x, b ) );
+      if( !telemetry.quiet() )
+      {
+         cout << "[qr] size: " << A.nRows() << " x " << A.nColumns() << " (complex)" << "\n";
+         cout << "[qr] rank: " << rank << "\n";
+      }
    }
 
    template <>
@@ -180,14 +187,17 @@ namespace DDG
                 DenseMatrix<Quaternion>& b )
    // solves the sparse linear system Ax = b using sparse QR factorization
    {
-      int t0 = clock();
+      Timer timer;
       x = SuiteSparseQR<double>( A.to_cholmod(), b.to_cholmod(), context );
-      int t1 = clock();
 
-      cout << "[qr] time: " << seconds( t0, t1 ) << "s" << "\n";
-      cout << "[qr] max residual: " << residual( A, x, b ) << "\n";
-      cout << "[qr] size: " << A.nRows() << " x " << A.nColumns() << " (quaternion)" << "\n";
-      cout << "[qr] rank: " << (*context).SPQR_istat[4]/4 << "\n";
+      int rank = (*context).SPQR_istat[4]/4;
+      telemetry.record( "qr.rank", rank );
+      reportSolve( "qr", timer.elapsed(), residual( A, x, b ) );
+      if( !telemetry.quiet() )
+      {
+         cout << "[qr] size: " << A.nRows() << " x " << A.nColumns() << " (quaternion)" << "\n";
+         cout << "[qr] rank: " << rank << "\n";
+      }
    }
 
    template <>
@@ -196,7 +206,7 @@ namespace DDG
                         DenseMatrix<Complex>& b )
    // solves the sparse linear system Ax = b using sparse LU factorization
    {
-      int t0 = clock();
+      Timer timer;
       cholmod_sparse* Ac = A.to_cholmod();
       int n = Ac->nrow;
       SuiteSparse_long* Ap = (SuiteSparse_long*) Ac->p;
@@ -211,8 +221,6 @@ namespace DDG
       umfpack_zl_free_symbolic( &Symbolic );
       umfpack_zl_free_numeric( &Numeric );
 
-      int t1 = clock();
-      cout << "[lu] time: " << seconds( t0, t1 ) << "s" << "\n";
-      cout << "[lu] max residual: " << residual( A, x, b ) << "\n";
+      reportSolve( "lu", timer.elapsed(), residual( A, x, b ) );
    }
 }
@@ -13,15 +13,34 @@ using namespace std;
 #include "SparseMatrix.h"
 #include "DenseMatrix.h"
 #include "LinearContext.h"
+#include "Telemetry.h"
 #include "Utility.h"
 
 namespace DDG
 {
-   extern LinearContext context;
+   extern thread_local LinearContext& context;
+   extern Telemetry telemetry;
 
    const int maxEigIter = 20;
    // number of iterations used to solve eigenvalue problems
 
+   inline void reportSolve( const std::string& tag, double time, double res )
+   // records the wall-clock time and residual of a solve under tag,
+   // and prints them unless telemetry is in quiet mode
+   {
+      telemetry.record( tag + ".time", time );
+      telemetry.record( tag + ".residual", res );
+      telemetry.print( tag, "time", time, "s" );
+      telemetry.print( tag, "max residual", res );
+   }
+
+   inline void reportFactor( const std::string& tag, cholmod_common* common )
+   // records statistics of the most recent CHOLMOD analysis under tag
+   {
+      telemetry.record( tag + ".nnzL", common->lnz );
+      telemetry.record( tag + ".flops", common->fl );
+   }
+
    template <class T>
    SparseMatrix<T> :: SparseMatrix( int m_, int n_ )
    // initialize an mxn matrix
@@ -496,7 +515,7 @@ namespace DDG
                         DenseMatrix<T>& b )
    // solves the sparse linear system Ax = b using sparse LU factorization
    {
-      int t0 = clock();
+      Timer timer;
       cholmod_sparse* Ac = A.to_cholmod();
       int n = Ac->nrow;
       SuiteSparse_long* Ap = (SuiteSparse_long*) Ac->p;
@@ -511,9 +530,7 @@ namespace DDG
       umfpack_dl_free_symbolic( &Symbolic );
       umfpack_dl_free_numeric( &Numeric );
 
-      int t1 = clock();
-      cout << "[lu] time: " << seconds( t0, t1 ) << "s" << "\n";
-      cout << "[lu] max residual: " << residual( A, x, b ) << "\n";
+      reportSolve( "lu", timer.elapsed(), residual( A, x, b ) );
    }
 
    template <class T>
@@ -522,18 +539,28 @@ namespace DDG
                                 DenseMatrix<T>& b )
    // solves the positive definite sparse linear system Ax = b using sparse Cholesky factorization
    {
-      int t0 = clock();
+      Timer timer;
       cholmod_sparse* Ac = A.to_cholmod();
       Ac->stype = 1;
-      cholmod_factor* L = cholmod_l_analyze( Ac, context );
-      cholmod_l_factorize( Ac, L, context );
-      x = cholmod_l_solve( CHOLMOD_A, L, b.to_cholmod(), context );
+
+      cholmod_factor* L;
+      {
+         ScopedTimer t( telemetry, "chol.analyze" );
+         L = cholmod_l_analyze( Ac, context );
+      }
+      {
+         ScopedTimer t( telemetry, "chol.factorize" );
+         cholmod_l_factorize( Ac, L, context );
+      }
+      reportFactor( "chol", context );
+      {
+         ScopedTimer t( telemetry, "chol.solve" );
+         x = cholmod_l_solve( CHOLMOD_A, L, b.to_cholmod(), context );
+      }
 
       if( L ) cholmod_l_free_factor( &L, context );
-      int t1 = clock();
 
-      cout << "[chol] time: " << seconds( t0, t1 ) << "s" << "\n";
-      cout << "[chol] max residual: " << residual( A, x, b ) << "\n";
+      reportSolve( "chol", timer.elapsed(), residual( A, x, b ) );
    }
 
    template <class T>
@@ -542,6 +569,7 @@ namespace DDG
                                      DenseMatrix<T>& b )
    // backsolves the prefactored positive definite sparse linear system LL'x = b
    {
+      ScopedTimer t( telemetry, "chol.solve" );
       x = cholmod_l_solve( CHOLMOD_A, L.to_cholmod(), b.to_cholmod(), context );
    }
 
@@ -552,7 +580,7 @@ namespace DDG
    // solves A x = lambda x for the smallest nonzero eigenvalue lambda
    // A must be symmetric; x is used as an initial guess
    {
-      int t0 = clock();
+      Timer timer;
       for( int iter = 0; iter < maxEigIter; iter++ )
       {
          solve( A, x, x );
@@ -562,10 +590,8 @@ namespace DDG
          }
          x.normalize();
       }
-      int t1 = clock();
-
-      cout << "[eig] time: " << seconds( t0, t1 ) << "s" << "\n";
-      cout << "[eig] max residual: " << residual( A, x ) << "\n";
+      telemetry.record( "eig.iterations", maxEigIter );
+      reportSolve( "eig", timer.elapsed(), residual( A, x ) );
    }
 
    template <class T>
@@ -577,7 +603,7 @@ namespace DDG
    {
       // TODO use a symmetric matrix decomposition instead of QR
 
-      int t0 = clock();
+      Timer timer;
 
       // create vector e that has unit norm w.r.t. B
       int n = A.length();
@@ -593,10 +619,8 @@ namespace DDG
          x -= dot( x, Be ).conj()*e;
          x /= dot( x, B*x ).norm(); 
       }
-      int t1 = clock();
-
-      cout << "[eig] time: " << seconds( t0, t1 ) << "s" << "\n";
-      cout << "[eig] max residual: " << residual( A, B, x ) << "\n";
+      telemetry.record( "eig.iterations", maxEigIter );
+      reportSolve( "eig", timer.elapsed(), residual( A, B, x ) );
    }
 
    template <class T>
@@ -606,7 +630,7 @@ namespace DDG
    // solves A x = lambda x for the smallest nonzero eigenvalue lambda
    // A must be positive (semi-)definite; x is used as an initial guess
    {
-      int t0 = clock();
+      Timer timer;
       SparseFactor<T> L;
       L.build( A );
 
@@ -619,10 +643,8 @@ namespace DDG
          }
          x.normalize();
       }
-      int t1 = clock();
-
-      cout << "[eig] time: " << seconds( t0, t1 ) << "s" << "\n";
-      cout << "[eig] max residual: " << residual( A, x ) << "\n";
+      telemetry.record( "eig.iterations", maxEigIter );
+      reportSolve( "eig", timer.elapsed(), residual( A, x ) );
    }
 
    template <class T>
@@ -632,7 +654,7 @@ namespace DDG
    // solves A x = lambda x for the smallest nonzero eigenvalue lambda
    // A must be positive (semi-)definite; x is used as an initial guess
    {
-      int t0 = clock();
+      Timer timer;
 
       SparseFactor<T> L;
       L.build( A );
@@ -651,10 +673,8 @@ namespace DDG
          x -= dot( x, Be ).conj()*e;
          x /= sqrt( dot( x, B*x ).norm() );
       }
-      int t1 = clock();
-
-      cout << "[eig] time: " << seconds( t0, t1 ) << "s" << "\n";
-      cout << "[eig] max residual: " << residual( A, B, x ) << "\n";
+      telemetry.record( "eig.iterations", maxEigIter );
+      reportSolve( "eig", timer.elapsed(), residual( A, B, x ) );
    }
 
    template <class T>
@@ -667,7 +687,7 @@ namespace DDG
    // x is used as an initial guess
    {
       int iter;
-      int t0 = clock();
+      Timer timer;
       DenseMatrix<T> ET = E.transpose();
       SparseFactor<T> L;
       L.build( A );
@@ -678,10 +698,8 @@ namespace DDG
          backsolvePositiveDefinite( L, x, x );
          x.normalize();
       }
-      int t1 = clock();
-
-      cout << "[eig] time: " << seconds( t0, t1 ) << "s" << "\n";
-      cout << "[eig] max residual: " << residual( A, B, E, x ) << "\n";
+      telemetry.record( "eig.iterations", maxEigIter );
+      reportSolve( "eig", timer.elapsed(), residual( A, B, E, x ) );
    }
 
    template <class T>
@@ -791,20 +809,48 @@ namespace DDG
          L = NULL;
       }
 
-      int t0, t1;
-
       cholmod_sparse* Ac = A.to_cholmod();
       Ac->stype = 1;
 
-      t0 = clock();
+      Timer timer;
       L = cholmod_l_analyze( Ac, context );
-      t1 = clock();
-      cerr << "analyze: " << seconds(t0,t1) << "s" << endl;
+      double tAnalyze = timer.elapsed();
+      telemetry.record( "chol.analyze", tAnalyze );
+      telemetry.print( "chol", "analyze", tAnalyze, "s" );
 
-      t0 = clock();
+      timer.start();
       cholmod_l_factorize( Ac, L, context );
-      t1 = clock();
-      cerr << "factorize: " << seconds(t0,t1) << "s" << endl;
+      double tFactorize = timer.elapsed();
+      telemetry.record( "chol.factorize", tFactorize );
+      telemetry.print( "chol", "factorize", tFactorize, "s" );
+
+      reportFactor( "chol", context );
+   }
+
+   template <class T>
+   bool SparseFactor<T> :: refactor( SparseMatrix<T>& A )
+   {
+      cholmod_common* common = context;
+      bool ok;
+
+      if( L == NULL or L->n != (size_t) A.nRows() )
+      {
+         // nothing to reuse
+         build( A );
+         ok = L != NULL and common->status == CHOLMOD_OK;
+      }
+      else
+      {
+         cholmod_sparse* Ac = A.to_cholmod();
+         Ac->stype = 1;
+
+         ScopedTimer t( telemetry, "chol.factorize" );
+         ok = cholmod_l_factorize( Ac, L, context ) and common->status == CHOLMOD_OK;
+      }
+
+      // if CHOLMOD rejects A outright, L (including minor) is left as it
+      // was; otherwise it stops at the first non-positive pivot
+      return ok and L->minor == L->n;
    }
 
    template <class T>
@@ -0,0 +1,245 @@
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <limits>
+using namespace std;
+
+#include "Telemetry.h"
+
+namespace DDG
+{
+   // global registry for solver measurements
+   Telemetry telemetry;
+
+   Timer :: Timer( void )
+   // starts the timer
+   {
+      start();
+   }
+
+   void Timer :: start( void )
+   // restarts the timer
+   {
+      t0 = chrono::steady_clock::now();
+   }
+
+   double Timer :: elapsed( void ) const
+   // returns wall-clock seconds since the timer was (re)started
+   {
+      return chrono::duration<double>( chrono::steady_clock::now() - t0 ).count();
+   }
+
+   Telemetry::Statistic :: Statistic( void )
+   : count( 0 ),
+     total( 0. ),
+     min( numeric_limits<double>::infinity() ),
+     max( -numeric_limits<double>::infinity() ),
+     last( 0. )
+   {}
+
+   void Telemetry::Statistic :: add( double value )
+   // includes value in the summary
+   {
+      count++;
+      total += value;
+      if( value < min ) min = value;
+      if( value > max ) max = value;
+      last = value;
+   }
+
+   Telemetry :: Telemetry( void )
+   // constructor
+   : isQuiet( false )
+   {}
+
+   void Telemetry :: record( const string& name, double value )
+   // adds a sample to the named statistic
+   {
+      lock_guard<std::mutex> lock( mutex );
+
+      statistics[ name ].add( value );
+   }
+
+   void Telemetry :: clear( void )
+   // discards all statistics
+   {
+      lock_guard<std::mutex> lock( mutex );
+
+      statistics.clear();
+   }
+
+   bool Telemetry :: has( const string& name ) const
+   // returns true if at least one sample was recorded under name
+   {
+      lock_guard<std::mutex> lock( mutex );
+
+      return statistics.find( name ) != statistics.end();
+   }
+
+   Telemetry::Statistic Telemetry :: get( const string& name ) const
+   // returns a copy of the named statistic (empty if never recorded)
+   {
+      lock_guard<std::mutex> lock( mutex );
+
+      StatisticMap::const_iterator s = statistics.find( name );
+      if( s == statistics.end() )
+      {
+         return Statistic();
+      }
+
+      return s->second;
+   }
+
+   void Telemetry :: setQuiet( bool quiet_ )
+   // enables or disables quiet mode
+   {
+      lock_guard<std::mutex> lock( mutex );
+
+      isQuiet = quiet_;
+   }
+
+   bool Telemetry :: quiet( void ) const
+   // returns true if solvers should not print progress
+   {
+      lock_guard<std::mutex> lock( mutex );
+
+      return isQuiet;
+   }
+
+   void Telemetry :: print( const string& tag, const string& label, double value, const char* unit ) const
+   // prints "[tag] label: value unit" to stdout unless in quiet mode
+   {
+      if( quiet() ) return;
+
+      lock_guard<std::mutex> lock( mutex );
+
+      cout << "[" << tag << "] " << label << ": " << value << unit << "\n";
+   }
+
+   static void writeJSONNumber( ostream& out, double value )
+   // JSON has no NaN or infinity, so those are written as null
+   {
+      if( std::isfinite( value )) out << value;
+      else out << "null";
+   }
+
+   static void writeJSONString( ostream& out, const string& s )
+   {
+      out << "\"";
+      for( string::const_iterator c = s.begin(); c != s.end(); c++ )
+      {
+         if( *c == '"' or *c == '\\' ) out << '\\' << *c;
+         else if( (unsigned char) *c < 0x20 )
+         {
+            const char* digits = "0123456789abcdef";
+            out << "\\u00" << digits[ *c >> 4 ] << digits[ *c & 0xf ];
+         }
+         else out << *c;
+      }
+      out << "\"";
+   }
+
+   void Telemetry :: writeJSON( ostream& out ) const
+   // writes all statistics as a JSON object keyed by name
+   {
+      lock_guard<std::mutex> lock( mutex );
+
+      out.precision( 17 );
+      out << "{";
+      for( StatisticMap::const_iterator s  = statistics.begin();
+                                        s != statistics.end();
+                                        s ++ )
+      {
+         const Statistic& x( s->second );
+
+         if( s != statistics.begin() ) out << ",";
+         out << "\n  ";
+         writeJSONString( out, s->first );
+         out << ": { \"count\": " << x.count << ", \"total\": ";
+         writeJSONNumber( out, x.total );
+         out << ", \"mean\": ";
+         writeJSONNumber( out, x.count ? x.total / x.count
+                                       : numeric_limits<double>::quiet_NaN() );
+         out << ", \"min\": ";
+         writeJSONNumber( out, x.min );
+         out << ", \"max\": ";
+         writeJSONNumber( out, x.max );
+         out << ", \"last\": ";
+         writeJSONNumber( out, x.last );
+         out << " }";
+      }
+      out << "\n}\n";
+   }
+
+   void Telemetry :: writeCSV( ostream& out ) const
+   // writes all statistics as CSV, one row per name
+   {
+      lock_guard<std::mutex> lock( mutex );
+
+      out.precision( 17 );
+      out << "name,count,total,mean,min,max,last\n";
+      for( StatisticMap::const_iterator s  = statistics.begin();
+                                        s != statistics.end();
+                                        s ++ )
+      {
+         const Statistic& x( s->second );
+
+         out << s->first << ","
+             << x.count << ","
+             << x.total << ","
+             << x.total / x.count << ","
+             << x.min << ","
+             << x.max << ","
+             << x.last << "\n";
+      }
+   }
+
+   int Telemetry :: writeJSON( const string& filename ) const
+   {
+      ofstream out( filename.c_str() );
+
+      if( !out.is_open() )
+      {
+         cerr << "Error writing to telemetry file " << filename << endl;
+         return 1;
+      }
+
+      writeJSON( out );
+
+      return 0;
+   }
+
+   int Telemetry :: writeCSV( const string& filename ) const
+   {
+      ofstream out( filename.c_str() );
+
+      if( !out.is_open() )
+      {
+         cerr << "Error writing to telemetry file " << filename << endl;
+         return 1;
+      }
+
+      writeCSV( out );
+
+      return 0;
+   }
+
+   ScopedTimer :: ScopedTimer( Telemetry& telemetry_, const string& name_ )
+   // starts timing
+   : telemetry( telemetry_ ),
+     name( name_ )
+   {}
+
+   ScopedTimer :: ~ScopedTimer( void )
+   // records the elapsed wall-clock time under name
+   {
+      telemetry.record( name, timer.elapsed() );
+   }
+
+   double ScopedTimer :: elapsed( void ) const
+   // returns seconds elapsed so far
+   {
+      return timer.elapsed();
+   }
+}
+
@@ -0,0 +1,291 @@
+#include <algorithm>
+#include <cassert>
+using namespace std;
+
+#include "TermList.h"
+
+namespace DDG
+{
+   class TermCompare
+   // orders terms by variable address
+   {
+      public:
+         bool operator()( const TermList::Term& t, Variable* v ) const { return t.first < v; }
+   };
+
+   TermList :: TermList( void )
+   // constructs an empty list
+   : terms( local ),
+     nTerms( 0 ),
+     capacity( inlineCapacity )
+   {}
+
+   TermList :: TermList( const TermList& B )
+   // copy constructor
+   : terms( local ),
+     nTerms( 0 ),
+     capacity( inlineCapacity )
+   {
+      *this = B;
+   }
+
+   TermList :: TermList( TermList&& B ) noexcept
+   // move constructor -- steals the heap block of B (if any)
+   : terms( local ),
+     nTerms( 0 ),
+     capacity( inlineCapacity )
+   {
+      *this = std::move( B );
+   }
+
+   TermList :: ~TermList( void )
+   // destructor
+   {
+      if( !isLocal() )
+      {
+         delete [] terms;
+      }
+   }
+
+   TermList& TermList :: operator=( const TermList& B )
+   // copies B
+   {
+      if( this == &B ) return *this;
+
+      nTerms = 0;
+      reserve( B.nTerms );
+      copy( B.terms, B.terms + B.nTerms, terms );
+      nTerms = B.nTerms;
+
+      return *this;
+   }
+
+   TermList& TermList :: operator=( TermList&& B ) noexcept
+   // moves B into this list
+   {
+      if( this == &B ) return *this;
+
+      if( B.isLocal() )
+      {
+         // inline terms have to be copied, but never need more
+         // than our own (inline or heap) storage
+         copy( B.terms, B.terms + B.nTerms, terms );
+         nTerms = B.nTerms;
+      }
+      else
+      {
+         if( !isLocal() )
+         {
+            delete [] terms;
+         }
+
+         terms    = B.terms;
+         nTerms   = B.nTerms;
+         capacity = B.capacity;
+
+         B.terms    = B.local;
+         B.capacity = inlineCapacity;
+      }
+
+      B.nTerms = 0;
+
+      return *this;
+   }
+
+   TermList::iterator TermList :: begin( void )
+   {
+      return terms;
+   }
+
+   TermList::const_iterator TermList :: begin( void ) const
+   {
+      return terms;
+   }
+
+   TermList::iterator TermList :: end( void )
+   {
+      return terms + nTerms;
+   }
+
+   TermList::const_iterator TermList :: end( void ) const
+   {
+      return terms + nTerms;
+   }
+
+   int TermList :: size( void ) const
+   // returns the number of terms
+   {
+      return nTerms;
+   }
+
+   bool TermList :: empty( void ) const
+   // returns true if there are no terms
+   {
+      return nTerms == 0;
+   }
+
+   void TermList :: clear( void )
+   // removes all terms (capacity is retained)
+   {
+      nTerms = 0;
+   }
+
+   void TermList :: reserve( int n )
+   // makes room for at least n terms
+   {
+      if( n > capacity )
+      {
+         grow( n );
+      }
+   }
+
+   TermList::iterator TermList :: find( Variable* v )
+   // returns the term for variable v, or end() if v does not appear
+   {
+      iterator t = lowerBound( v );
+
+      if( t != end() && t->first == v )
+      {
+         return t;
+      }
+
+      return end();
+   }
+
+   TermList::const_iterator TermList :: find( Variable* v ) const
+   // returns the term for variable v, or end() if v does not appear
+   {
+      const_iterator t = lowerBound( v );
+
+      if( t != end() && t->first == v )
+      {
+         return t;
+      }
+
+      return end();
+   }
+
+   double& TermList :: operator[]( Variable* v )
+   // returns the coefficient of v, inserting a zero term if necessary
+   {
+      int k = lowerBound( v ) - terms;
+
+      if( k < nTerms && terms[k].first == v )
+      {
+         return terms[k].second;
+      }
+
+      reserve( nTerms + 1 );
+      copy_backward( terms + k, terms + nTerms, terms + nTerms + 1 );
+      terms[k] = Term( v, 0. );
+      nTerms++;
+
+      return terms[k].second;
+   }
+
+   void TermList :: push_back( Variable* v, double c )
+   // appends a term; v must be greater than every variable already in the list
+   {
+      assert( nTerms == 0 || terms[nTerms-1].first < v );
+
+      reserve( nTerms + 1 );
+      terms[ nTerms ] = Term( v, c );
+      nTerms++;
+   }
+
+   void TermList :: accumulate( const TermList& B, double s )
+   // adds s times the terms of B to this list
+   {
+      if( this == &B )
+      {
+         for( iterator t = begin(); t != end(); t++ )
+         {
+            t->second += s * t->second;
+         }
+         return;
+      }
+
+      // count variables of B that do not yet appear in this list
+      // (both lists are sorted, so a single simultaneous sweep suffices)
+      int nNew = 0;
+      const_iterator a = begin();
+      for( const_iterator b = B.begin(); b != B.end(); b++ )
+      {
+         while( a != end() && a->first < b->first ) a++;
+         if( a == end() || a->first != b->first ) nNew++;
+      }
+
+      if( nNew == 0 )
+      {
+         // every variable is already present -- just update coefficients
+         iterator t = begin();
+         for( const_iterator b = B.begin(); b != B.end(); b++ )
+         {
+            while( t->first < b->first ) t++;
+            t->second += s * b->second;
+         }
+         return;
+      }
+
+      // merge from the back so that no temporary storage is needed
+      reserve( nTerms + nNew );
+
+      int i = nTerms - 1;
+      int j = B.nTerms - 1;
+      int k = nTerms + nNew - 1;
+      while( j >= 0 )
+      {
+         if( i >= 0 && terms[i].first > B.terms[j].first )
+         {
+            terms[k--] = terms[i--];
+         }
+         else if( i >= 0 && terms[i].first == B.terms[j].first )
+         {
+            terms[k] = terms[i--];
+            terms[k--].second += s * B.terms[j--].second;
+         }
+         else
+         {
+            terms[k--] = Term( B.terms[j].first, s * B.terms[j].second );
+            j--;
+         }
+      }
+
+      nTerms += nNew;
+   }
+
+   void TermList :: swap( TermList& B )
+   // exchanges the contents of two lists
+   {
+      TermList tmp( std::move( B ) );
+      B = std::move( *this );
+      *this = std::move( tmp );
+   }
+
+   bool TermList :: isLocal( void ) const
+   {
+      return terms == local;
+   }
+
+   void TermList :: grow( int n )
+   {
+      int newCapacity = max( n, 2*capacity );
+      Term* newTerms = new Term[ newCapacity ];
+
+      copy( terms, terms + nTerms, newTerms );
+
+      if( !isLocal() )
+      {
+         delete [] terms;
+      }
+
+      terms = newTerms;
+      capacity = newCapacity;
+   }
+
+   TermList::iterator TermList :: lowerBound( Variable* v ) const
+   {
+      return lower_bound( terms, terms + nTerms, v, TermCompare() );
+   }
+}
+